@@ -0,0 +1,35 @@
+#include "Durability.h"
+
+#include <stdexcept>
+
+#include <cassert>
+
+namespace mba {
+
+std::string to_string( Durability durability )
+{
+	switch( durability ) {
+		case Durability::none: return "none";
+		case Durability::batch: return "batch";
+		case Durability::strict: return "strict";
+		default:
+			assert( false );
+			throw std::runtime_error( "Unkown durability:"
+									  + std::to_string( (std::underlying_type_t<Durability>)durability ) );
+			break;
+	}
+}
+
+std::optional<Durability> parse_Durability( std::string_view str )
+{
+	if( str == to_string( Durability::none ) ) {
+		return Durability::none;
+	} else if( str == to_string( Durability::batch ) ) {
+		return Durability::batch;
+	} else if( str == to_string( Durability::strict ) ) {
+		return Durability::strict;
+	}
+	return std::nullopt;
+}
+
+} // namespace mba
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace mba {
+
+// How hard we try to get the generated project onto the disk before it becomes visible
+//  - none:   files are written directly into the project directory
+//  - batch:  files are written into a staging directory, flushed with a single file system sync
+//            and then published with one rename
+//  - strict: like batch, but every file and directory is flushed individually
+enum class Durability { none, batch, strict };
+
+std::string               to_string( Durability durability );
+std::optional<Durability> parse_Durability( std::string_view str );
+
+} // namespace mba
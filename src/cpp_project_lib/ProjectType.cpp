@@ -6,43 +6,33 @@
 
 namespace mba {
 
-std::string to_string( ProjectType type )
+const ProjectTypeInfo& info( ProjectType type )
 {
-	switch( type ) {
-		case ProjectType::exec: return "executable";
-		case ProjectType::lib: return "library";
-		case ProjectType::lib_header_only: return "library-header-only";
-		default:
-			assert( false );
-			throw std::runtime_error( "Unkown project type:"
-									  + std::to_string( (std::underlying_type_t<ProjectType>)type ) );
-			break;
+	const auto idx = static_cast<std::size_t>( type );
+	if( idx >= project_types.size() ) {
+		assert( false );
+		throw std::runtime_error( "Unkown project type:"
+								  + std::to_string( (std::underlying_type_t<ProjectType>)type ) );
 	}
+	return project_types[idx];
 }
 
-std::string to_string_short( ProjectType type )
+std::string_view to_string( ProjectType type )
 {
-	switch( type ) {
-		case ProjectType::exec: return "exec";
-		case ProjectType::lib: return "lib";
-		case ProjectType::lib_header_only: return "header";
-		default:
-			assert( false );
-			throw std::runtime_error( "Unkown project type:"
-									  + std::to_string( (std::underlying_type_t<ProjectType>)type ) );
-			break;
-	}
+	return info( type ).name;
+}
+
+std::string_view to_string_short( ProjectType type )
+{
+	return info( type ).short_name;
 }
 
 std::optional<ProjectType> parse_ProjectType( std::string_view str )
 {
-	if( ( str == to_string( ProjectType::exec ) ) || ( str == to_string_short( ProjectType::exec ) ) ) {
-		return ProjectType::exec;
-	} else if( ( str == to_string( ProjectType::lib ) ) || ( str == to_string_short( ProjectType::lib ) ) ) {
-		return ProjectType::lib;
-	} else if( ( str == to_string( ProjectType::lib_header_only ) )
-			   || ( str == to_string_short( ProjectType::lib_header_only ) ) ) {
-		return ProjectType::lib_header_only;
+	for( const auto& t : project_types ) {
+		if( str == t.name || str == t.short_name ) {
+			return t.type;
+		}
 	}
 	return std::nullopt;
 }
@@ -1,15 +1,63 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
 
 namespace mba {
 
-enum class ProjectType { exec, lib, lib_header_only };
+enum class ProjectType { exec, lib, lib_header_only, lib_module };
 
-std::string                to_string( ProjectType type );
-std::string                to_string_short( ProjectType type );
+// Everything that differs between the project types.
+// Unused entries of template_groups and extra_dirs are empty.
+// Directories are relative to the project directory and may contain the TARGET_NAME filename placeholder.
+struct ProjectTypeInfo {
+	ProjectType                     type;
+	std::string_view                name;
+	std::string_view                short_name;
+	std::array<std::string_view, 2> template_groups; // installed on top of "common", in this order
+	std::array<std::string_view, 2> extra_dirs;      // empty directories created in the project
+	std::string_view                cmake_visibility;
+	std::string_view                link_name_suffix;     // appended to the default cmake link target
+	bool                            has_compiled_sources; // needed by features that add .cpp files
+	std::string_view                source_dir;           // where features add source files
+	std::string_view                header_dir;           // where features add headers
+	std::string_view                feature_group_suffix; // optional type specific part of a feature: <feature>-<suffix>
+	std::string_view                cmake_generator;      // generator the project requires (empty: any)
+};
+
+// clang-format off
+inline constexpr std::array<ProjectTypeInfo, 4> project_types{{
+	{ ProjectType::exec,            "executable",          "exec",   { "exec" },                       { "src", "libs" },
+	  "PUBLIC",    "_lib", true,  "src/TARGET_NAME_lib", "src/TARGET_NAME_lib", "exec", "" },
+	{ ProjectType::lib,             "library",             "lib",    { "lib-common", "lib-compiled" }, {},
+	  "PUBLIC",    "",     true,  "src",                 "include/TARGET_NAME", "lib",  "" },
+	{ ProjectType::lib_header_only, "library-header-only", "header", { "lib-common", "lib-header" },   {},
+	  "INTERFACE", "",     false, "",                    "include/TARGET_NAME", "lib",  "" },
+	{ ProjectType::lib_module,      "library-module",      "module", { "lib-common", "lib-module" },   {},
+	  "PUBLIC",    "",     true,  "src",                 "include/TARGET_NAME", "lib",  "Ninja" },
+}};
+// clang-format on
+
+namespace detail {
+constexpr bool project_types_in_enum_order()
+{
+	for( std::size_t i = 0; i < project_types.size(); ++i ) {
+		if( project_types[i].type != static_cast<ProjectType>( i ) ) {
+			return false;
+		}
+	}
+	return true;
+}
+} // namespace detail
+
+static_assert( detail::project_types_in_enum_order(), "project_types has to be indexable by ProjectType" );
+
+const ProjectTypeInfo&     info( ProjectType type );
+std::string_view           to_string( ProjectType type );
+std::string_view           to_string_short( ProjectType type );
 std::optional<ProjectType> parse_ProjectType( std::string_view str );
 
 } // namespace mba
@@ -6,4 +6,15 @@ namespace mba {
 
 std::filesystem::path get_exec_directory();
 
+// Flush a file / the entries of a directory to the disk
+void sync_file( const std::filesystem::path& file );
+void sync_directory( const std::filesystem::path& dir );
+
+// Flush everything below dir to the disk, ideally with a single call for the whole file system
+void sync_filesystem( const std::filesystem::path& dir );
+
+// Creates `to` as a copy-on-write clone of `from`
+// returns false if the file system (or platform) doesn't support that
+bool reflink_file( const std::filesystem::path& from, const std::filesystem::path& to );
+
 } // namespace mba
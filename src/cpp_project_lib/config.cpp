@@ -7,6 +7,7 @@
 
 #include <filesystem>
 #include <sstream>
+#include <stdexcept>
 
 namespace mba {
 
@@ -45,22 +46,31 @@ Config parse_config( int argc, char** argv )
 	cxxopts::Options options( "cpp_project",
 							  "A simple tool to create a standard project layout for executables or libraries" );
 
+	std::string type_option_string;
+	for( const auto& t : project_types ) {
+		type_option_string += ( type_option_string.empty() ? "" : " | " ) + std::string( t.short_name );
+	}
+
 	// clang-format off
-	const std::string type_option_string =
-		to_string_short(ProjectType::exec) + " | "	+
-		to_string_short(ProjectType::lib) + " | "	+
-		to_string_short(ProjectType::lib_header_only);
 
 	options.add_options()
 		("h,help",          "print this documentation")
 		("N,name",          "Project name",										   cxxopts::value<std::string>() )
-		("t,type",          "Project type ( "+type_option_string+" )",			   cxxopts::value<std::string>()->default_value( to_string_short( ProjectType::exec ) ) )
+		("t,type",          "Project type ( "+type_option_string+" )",			   cxxopts::value<std::string>()->default_value( std::string( to_string_short( ProjectType::exec ) ) ) )
 		("T,target",        "Target name",                                         cxxopts::value<std::string>() )
 		("n,namespace",     "namespace used in the library",                       cxxopts::value<std::string>() )
 		("c,cmake_namespace", "namespace for the cmake",                           cxxopts::value<std::string>() )
 		("m,module",        "component name inside cmake namespace",               cxxopts::value<std::string>() )
 		("l,link_target",   "target name used by cmake to link to the library",    cxxopts::value<std::string>() )
-		("g,git",           "creates a git repository (requires git to be installed)" );
+		("g,git",           "creates a git repository (requires git to be installed)" )
+		("simd-dispatch",   "adds SIMD kernels with runtime cpu feature dispatch (not for header only libraries)" )
+		("profiling",       "adds a tracing header (records the first 65536 zones per thread), example instrumentation and a profiling build configuration" )
+		("durability",      "none: write into the project directory | batch: generate into a staging directory, sync once and publish with a single rename | strict: like batch but sync every file",
+		                                                                           cxxopts::value<std::string>()->default_value( to_string( Durability::none ) ) )
+		("dedupe",          "none | hardlink | reflink: share files that are identical across generated projects through a content addressed store. hardlink: only .clang-format, .gitignore and tests/main.cpp, made read-only - editing them anyway (e.g. as root) changes them in every project | reflink: every shared file, copy-on-write (btrfs, xfs, ...) and safe to edit",
+		                                                                           cxxopts::value<std::string>()->default_value( to_string( DedupeMode::none ) ) )
+		("dedupe-store",    "directory of the content addressed store (default: .cpp_project_store next to the project)",
+		                                                                           cxxopts::value<std::string>() );
 	// clang-format on
 
 	options.parse_positional( {"name"} );
@@ -74,6 +84,15 @@ Config parse_config( int argc, char** argv )
 	cfg.create_git = result.count( "git" ) > 0;
 
 	cfg.prj_type     = parse_ProjectType( result["type"].as<std::string>() ).value();
+
+	cfg.durability    = parse_Durability( result["durability"].as<std::string>() ).value();
+	cfg.dedupe        = parse_DedupeMode( result["dedupe"].as<std::string>() ).value();
+	cfg.profiling     = result.count( "profiling" ) > 0;
+	cfg.simd_dispatch = result.count( "simd-dispatch" ) > 0;
+	if( cfg.simd_dispatch && !info( cfg.prj_type ).has_compiled_sources ) {
+		throw std::runtime_error( "SIMD dispatch requires compiled sources and can't be used for "
+								  + std::string( to_string( cfg.prj_type ) ) + " projects" );
+	}
 	cfg.template_dir = get_template_directory();
 
 	// by default, use current directory
@@ -81,6 +100,7 @@ Config parse_config( int argc, char** argv )
 
 	cfg.names.project = result["name"].as<std::string>();
 	cfg.project_dir   = fs::current_path() / cfg.names.project;
+	cfg.dedupe_store  = get_or( result, "dedupe-store", ( cfg.project_dir.parent_path() / ".cpp_project_store" ).string() );
 	cfg.names                = create_default_names( cfg.names.project );
 	cfg.names.target         = get_or( result, "target", cfg.names.target );
 	cfg.names.ns             = get_or( result, "namespace", cfg.names.ns );
@@ -88,7 +108,7 @@ Config parse_config( int argc, char** argv )
 	cfg.names.component_name = get_or( result, "module", cfg.names.component_name );
 
 	const std::string default_link_name
-		= cfg.names.cmake_ns + "::" + cfg.names.component_name + ( cfg.prj_type == ProjectType::exec ? "_lib" : "" );
+		= cfg.names.cmake_ns + "::" + cfg.names.component_name + std::string( info( cfg.prj_type ).link_name_suffix );
 
 	cfg.names.cmake_link_target = get_or( result, "l", default_link_name );
 
@@ -113,7 +133,11 @@ std::string to_string( const Config& cfg )
 	   << "\n namespace:             " << cfg.names.ns
 	   << "\n cmake namespace:       " << cfg.names.cmake_ns
 	   << "\n cmake component name:  " << cfg.names.component_name
-	   << "\n cmake link target:     " << cfg.names.cmake_link_target;
+	   << "\n cmake link target:     " << cfg.names.cmake_link_target
+	   << "\n SIMD dispatch:         " << ( cfg.simd_dispatch ? "yes" : "no" )
+	   << "\n Profiling:             " << ( cfg.profiling ? "yes" : "no" )
+	   << "\n Durability:            " << to_string( cfg.durability )
+	   << "\n Dedupe:                " << to_string( cfg.dedupe );
 	// clang-format on
 
 	return ss.str();
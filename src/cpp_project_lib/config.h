@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Durability.h"
 #include "ProjectType.h"
+#include "dedupe.h"
 
 #include <filesystem>
 #include <string>
@@ -22,6 +24,11 @@ struct Config {
 	std::filesystem::path template_dir;
 	std::filesystem::path project_dir;
 	bool                  create_git;
+	bool                  simd_dispatch;
+	bool                  profiling;
+	Durability            durability;
+	DedupeMode            dedupe;
+	std::filesystem::path dedupe_store;
 };
 
 std::string to_string( const Config& cfg );
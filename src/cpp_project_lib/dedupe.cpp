@@ -0,0 +1,260 @@
+#include "dedupe.h"
+
+#include "arch.h"
+#include "helpers.h"
+
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace mba {
+
+namespace fs = std::filesystem;
+
+std::string to_string( DedupeMode mode )
+{
+	switch( mode ) {
+		case DedupeMode::none: return "none";
+		case DedupeMode::hardlink: return "hardlink";
+		case DedupeMode::reflink: return "reflink";
+		default:
+			assert( false );
+			throw std::runtime_error( "Unkown dedupe mode:" + std::to_string( (std::underlying_type_t<DedupeMode>)mode ) );
+			break;
+	}
+}
+
+std::optional<DedupeMode> parse_DedupeMode( std::string_view str )
+{
+	if( str == to_string( DedupeMode::none ) ) {
+		return DedupeMode::none;
+	} else if( str == to_string( DedupeMode::hardlink ) ) {
+		return DedupeMode::hardlink;
+	} else if( str == to_string( DedupeMode::reflink ) ) {
+		return DedupeMode::reflink;
+	}
+	return std::nullopt;
+}
+
+namespace {
+
+// FNV-1a, collisions are detected by comparing the content
+std::uint64_t hash( const std::string& content )
+{
+	std::uint64_t h = 14695981039346656037ull;
+	for( unsigned char c : content ) {
+		h ^= c;
+		h *= 1099511628211ull;
+	}
+	return h;
+}
+
+fs::path object_path( const fs::path& store, const std::string& content )
+{
+	char name[40];
+	std::snprintf( name,
+				   sizeof( name ),
+				   "%016llx-%llx",
+				   static_cast<unsigned long long>( hash( content ) ),
+				   static_cast<unsigned long long>( content.size() ) );
+	return store / std::string( name, 2 ) / name;
+}
+
+// Objects are never modified after they have been created.
+// They are read-only, so an in-place edit of a hard linked file fails instead of changing every project
+void create_object( const fs::path& object, const std::string& content )
+{
+	fs::create_directories( object.parent_path() );
+	const fs::path tmp = object.string() + ".tmp";
+	set_file_content( tmp, content );
+	fs::permissions( tmp,
+					 fs::perms::owner_write | fs::perms::group_write | fs::perms::others_write,
+					 fs::perm_options::remove );
+	fs::rename( tmp, object );
+}
+
+// Hard links share the file itself: the read-only mode of the object is the only thing that keeps an edit
+// (e.g. by root or after a chmod) from changing every project and the store.
+// So hard links are only used for files that users have no reason to edit.
+bool is_never_edited( const fs::path& relative_path )
+{
+	const std::string path = relative_path.generic_string();
+	return path == ".clang-format" || path == ".gitignore" || path == "tests/main.cpp";
+}
+
+bool link_to_object( const fs::path& object, const fs::path& file, DedupeMode mode )
+{
+	const fs::path tmp = file.string() + ".dedupe";
+	fs::remove( tmp );
+
+	bool linked = false;
+	if( mode == DedupeMode::hardlink ) {
+		std::error_code ec;
+		fs::create_hard_link( object, tmp, ec );
+		linked = !ec;
+	} else {
+		linked = reflink_file( object, tmp );
+	}
+	if( !linked ) {
+		return false;
+	}
+	// replaces the file atomically
+	fs::rename( tmp, file );
+	return true;
+}
+
+// Content that so far occurs in a single project: object name -> location of that (first) copy.
+// Most files are never seen a second time, so the locations are kept in a few shard files
+// (one per first byte of the hash) instead of one file per record.
+class PendingIndex {
+public:
+	explicit PendingIndex( fs::path dir )
+		: _dir( std::move( dir ) )
+	{
+	}
+
+	// Locations may not exist yet: a staged project is only published after it has been deduplicated
+	void save()
+	{
+		for( const auto& [shard_name, shard] : _shards ) {
+			if( !shard.modified ) {
+				continue;
+			}
+			std::string text;
+			for( const auto& [name, location] : shard.entries ) {
+				text += name + ' ' + location + '\n';
+			}
+			const fs::path file = _dir / ( shard_name + ".txt" );
+			const fs::path tmp  = file.string() + ".tmp";
+			fs::create_directories( _dir );
+			set_file_content( tmp, text );
+			fs::rename( tmp, file );
+		}
+	}
+
+	std::optional<fs::path> find( const std::string& name )
+	{
+		auto& entries = shard( name ).entries;
+		auto  it      = entries.find( name );
+		if( it == entries.end() ) {
+			return std::nullopt;
+		}
+		return fs::path( it->second );
+	}
+
+	void set( const std::string& name, const fs::path& location )
+	{
+		auto& s         = shard( name );
+		s.entries[name] = location.string();
+		s.modified      = true;
+	}
+
+	void erase( const std::string& name )
+	{
+		auto& s = shard( name );
+		s.entries.erase( name );
+		s.modified = true;
+	}
+
+private:
+	struct Shard {
+		std::map<std::string, std::string> entries;
+		bool                               modified = false;
+	};
+
+	Shard& shard( const std::string& name )
+	{
+		const std::string shard_name = name.substr( 0, 2 );
+		auto [it, inserted]          = _shards.try_emplace( shard_name );
+		if( inserted ) {
+			std::ifstream in( _dir / ( shard_name + ".txt" ) );
+			std::string   line;
+			while( std::getline( in, line ) ) {
+				const std::size_t sep = line.find( ' ' );
+				if( sep != std::string::npos ) {
+					it->second.entries[line.substr( 0, sep )] = line.substr( sep + 1 );
+				}
+			}
+		}
+		return it->second;
+	}
+
+	fs::path                     _dir;
+	std::map<std::string, Shard> _shards;
+};
+
+} // namespace
+
+DedupeStats dedupe_tree( const fs::path& dir, const fs::path& store, DedupeMode mode, const fs::path& published_dir )
+{
+	DedupeStats stats;
+	if( mode == DedupeMode::none ) {
+		return stats;
+	}
+
+	PendingIndex pending( store / "pending" );
+
+	for( const auto& entry : fs::recursive_directory_iterator( dir ) ) {
+		if( !entry.is_regular_file() || entry.is_symlink() ) {
+			continue;
+		}
+		++stats.files;
+
+		const bool never_edited = is_never_edited( entry.path().lexically_relative( dir ) );
+		if( mode == DedupeMode::hardlink && !never_edited ) {
+			continue;
+		}
+
+		const std::string content = get_file_content( entry.path() );
+		const fs::path    object  = object_path( store, content );
+
+		if( fs::exists( object ) ) {
+			if( get_file_content( object ) != content ) {
+				// hash collision, keep the copy
+				continue;
+			}
+			if( link_to_object( object, entry.path(), mode ) ) {
+				++stats.linked_files;
+				stats.bytes_saved += content.size();
+			}
+			continue;
+		}
+
+		if( never_edited ) {
+			create_object( object, content );
+			if( link_to_object( object, entry.path(), mode ) ) {
+				++stats.linked_files;
+			}
+			continue;
+		}
+
+		// Any other file only gets an object once a second project contains the same content.
+		// Until then the store just remembers where the first copy is (or will be, once it is published).
+		const std::string             name  = object.filename().string();
+		const std::optional<fs::path> first = pending.find( name );
+		if( !first || !fs::exists( *first ) || get_file_content( *first ) != content ) {
+			const fs::path location
+				= published_dir.empty() ? entry.path() : published_dir / entry.path().lexically_relative( dir );
+			pending.set( name, fs::absolute( location ) );
+			continue;
+		}
+		pending.erase( name );
+		create_object( object, content );
+		if( link_to_object( object, entry.path(), mode ) ) {
+			++stats.linked_files;
+			stats.bytes_saved += content.size();
+			link_to_object( object, *first, mode );
+		}
+	}
+	pending.save();
+	return stats;
+}
+
+} // namespace mba
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace mba {
+
+// How identical files of different generated projects share their storage
+//  - none:     every project gets its own copies
+//  - hardlink: files that are never edited (.clang-format, .gitignore, tests/main.cpp) become hard links
+//              to a read-only object in the store. An edit that bypasses the read-only mode changes every
+//              project that shares the file.
+//  - reflink:  files that occur in more than one project become copy-on-write clones of an object in
+//              the store (needs btrfs, xfs, ...)
+enum class DedupeMode { none, hardlink, reflink };
+
+std::string               to_string( DedupeMode mode );
+std::optional<DedupeMode> parse_DedupeMode( std::string_view str );
+
+struct DedupeStats {
+	std::size_t    files        = 0;
+	std::size_t    linked_files = 0;
+	std::uintmax_t bytes_saved  = 0;
+};
+
+// Replaces the files below dir that are already in the content addressed store (or that are known to be
+// shared) with links to the objects in the store. All other files stay normal, writable files.
+// Files that can't be linked (e.g. store on a different file system) are left untouched
+// If dir is a staging directory, published_dir is where it will be moved to (the store remembers file locations).
+DedupeStats dedupe_tree( const std::filesystem::path& dir,
+						 const std::filesystem::path& store,
+						 DedupeMode                   mode,
+						 const std::filesystem::path& published_dir = {} );
+
+} // namespace mba
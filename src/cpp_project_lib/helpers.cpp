@@ -1,8 +1,12 @@
 #include "helpers.h"
 
+#include "render.h"
 #include "variable_matchers.h"
 
+#include <algorithm>
 #include <cctype>
+#include <cerrno>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -34,14 +38,6 @@ std::string capitalize_first( const std::string& in )
 	return s;
 }
 
-void replace_inplace( std::string& src, const std::regex& reg, const std::string& replace )
-{
-	thread_local std::string buffer;
-	buffer.clear();
-	std::regex_replace( std::back_inserter( buffer ), src.begin(), src.end(), reg, replace );
-	src = buffer;
-}
-
 std::string get_file_content( const fs::path& src_path )
 {
 	std::ifstream in( src_path, std::ios::in | std::ios::binary );
@@ -126,7 +122,6 @@ void merge_snippets_into_files(const std::vector<std::filesystem::path>& files)
 
 void install_file( const fs::path& template_path, const fs::path& dest_path, const Config& cfg )
 {
-	const Names& names = cfg.names;
 	try {
 		std::ifstream source( template_path, std::ios_base::in | std::ios_base::binary );
 		if( !source.is_open() ) {
@@ -137,40 +132,40 @@ void install_file( const fs::path& template_path, const fs::path& dest_path, con
 			throw std::runtime_error( "Could not open destination file " + dest_path.string() );
 		}
 
-		std::string line;
-		while( std::getline( source, line ) ) {
-			replace_inplace( line, regex_prj, names.project );
-			replace_inplace( line, regex_target, names.target );
-			replace_inplace( line, regex_ns, names.ns );
-			replace_inplace( line, regex_link_target, names.cmake_link_target );
-			replace_inplace( line, regex_cmake_ns, names.cmake_ns );
-			if( cfg.prj_type == ProjectType::lib_header_only )
-				replace_inplace( line, regex_cmake_public_visibility, "INTERFACE" );
-			else
-				replace_inplace( line, regex_cmake_public_visibility, "PUBLIC" );
-
-			dest << line;
-			dest.put( '\n' );
-		}
+		const std::string text{std::istreambuf_iterator<char>( source ), std::istreambuf_iterator<char>()};
+		const std::string rendered = render_regex( text, cfg );
+		dest.write( rendered.data(), rendered.size() );
 	} catch( const std::exception& e ) {
 		std::cout << "Error while installing file" << template_path.u8string() << "\n"
 				  << "Error details: \n"
 				  << e.what() << std::endl;
+		throw;
+	}
+}
+
+std::string instantiate_filename( std::string filename, const Names& names )
+{
+	replace_inplace( filename, regex_project_filename, names.project );
+	replace_inplace( filename, regex_target_filename, names.target );
+	replace_inplace( filename, regex_component_filename, names.component_name );
+	return filename;
+}
+
+fs::path project_subdir( std::string_view relative_dir, const Config& cfg )
+{
+	fs::path dir = cfg.project_dir;
+	for( const auto& part : fs::path( relative_dir ) ) {
+		dir /= instantiate_filename( part.u8string(), cfg.names );
 	}
+	return dir;
 }
 
 std::vector<std::filesystem::path> install_recursive( const fs::path& template_dir, const fs::path& dest, const Config& cfg )
 {
 	std::vector<std::filesystem::path> ret;
 
-	const Names& names = cfg.names;
 	for( auto dir : fs::directory_iterator( template_dir ) ) {
-		std::string filename = dir.path().filename().u8string();
-		replace_inplace( filename, regex_project_filename, names.project );
-		replace_inplace( filename, regex_target_filename, names.target );
-		replace_inplace( filename, regex_component_filename, names.component_name );
-
-		auto new_element = dest / filename;
+		auto new_element = dest / instantiate_filename( dir.path().filename().u8string(), cfg.names );
 		if( dir.is_directory() ) {
 			fs::create_directories( new_element );
 			auto installed = install_recursive( dir, new_element, cfg );
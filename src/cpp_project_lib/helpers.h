@@ -7,6 +7,7 @@
 #include <iterator>
 #include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace mba {
@@ -15,6 +16,16 @@ std::string my_tolower( const std::string& s );
 
 std::string capitalize_first( const std::string& s );
 
+std::string get_file_content( const std::filesystem::path& src_path );
+
+void set_file_content( const std::filesystem::path& src_path, const std::string& text );
+
+// Replaces the PROJECT_NAME, TARGET_NAME and COMPONENT_NAME placeholders of a template filename
+std::string instantiate_filename( std::string filename, const Names& names );
+
+// Directory inside the project, relative_dir may contain filename placeholders (e.g. "src/TARGET_NAME_lib")
+std::filesystem::path project_subdir( std::string_view relative_dir, const Config& cfg );
+
 void install_file( const std::filesystem::path& template_path,
 				   const std::filesystem::path& dest_path,
 				   const Config&                cfg );
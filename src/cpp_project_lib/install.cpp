@@ -0,0 +1,131 @@
+#include "install.h"
+
+#include "ProjectType.h"
+#include "dedupe.h"
+#include "helpers.h"
+#include "staging.h"
+
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace mba {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// installs the type specific part of a feature (e.g. simd-dispatch-exec), if the feature has one
+void install_feature_group( const Config&                       cfg,
+							std::string_view                    feature,
+							std::vector<std::filesystem::path>& installed_files )
+{
+	const fs::path group_dir
+		= cfg.template_dir / ( std::string( feature ) + "-" + std::string( info( cfg.prj_type ).feature_group_suffix ) );
+	if( fs::exists( group_dir ) ) {
+		merge( installed_files, install_recursive( group_dir, cfg.project_dir, cfg ) );
+	}
+}
+
+void install_simd_dispatch( const Config& cfg, std::vector<std::filesystem::path>& installed_files )
+{
+	const fs::path& template_dir = cfg.template_dir;
+	const fs::path& project_dir  = cfg.project_dir;
+
+	// kernels are placed next to the other sources of the compiled target
+	const fs::path source_dir = project_subdir( info( cfg.prj_type ).source_dir, cfg );
+
+	fs::create_directories( source_dir / "kernels" );
+	fs::create_directories( project_dir / "tests" );
+	merge( installed_files,
+		   install_recursive( template_dir / "simd-dispatch" / "kernels", source_dir / "kernels", cfg ) );
+	merge( installed_files, install_recursive( template_dir / "simd-dispatch" / "tests", project_dir / "tests", cfg ) );
+	install_feature_group( cfg, "simd-dispatch", installed_files );
+}
+
+void install_profiling( const Config& cfg, std::vector<std::filesystem::path>& installed_files )
+{
+	const fs::path& template_dir = cfg.template_dir;
+	const fs::path& project_dir  = cfg.project_dir;
+
+	const fs::path header_dir = project_subdir( info( cfg.prj_type ).header_dir, cfg );
+
+	install_file( template_dir / "profiling" / "trace.hpp", header_dir / "trace.hpp", cfg );
+	install_file( template_dir / "profiling" / "CMAKE_PROFILING.cmake", project_dir / "CMAKE_PROFILING.cmake", cfg );
+	install_file( template_dir / "profiling" / "PRESET_PROFILING.json", project_dir / "PRESET_PROFILING.json", cfg );
+	installed_files.push_back( header_dir / "trace.hpp" );
+	installed_files.push_back( project_dir / "CMAKE_PROFILING.cmake" );
+	installed_files.push_back( project_dir / "PRESET_PROFILING.json" );
+	// profiling-exec replaces the example sources with instrumented versions
+	install_feature_group( cfg, "profiling", installed_files );
+}
+
+// published_dir is the final location of cfg.project_dir (differs while staging)
+void install_files( const Config& cfg, const fs::path& published_dir )
+{
+	const fs::path& template_dir = cfg.template_dir;
+	const fs::path& project_dir  = cfg.project_dir;
+
+	std::vector<std::filesystem::path> installed_files;
+
+	fs::create_directories( project_dir );
+	merge( installed_files, install_recursive( template_dir / "common", project_dir, cfg ) );
+	const ProjectTypeInfo& type_info = info( cfg.prj_type );
+	for( const auto group : type_info.template_groups ) {
+		if( !group.empty() ) {
+			merge( installed_files, install_recursive( template_dir / group, project_dir, cfg ) );
+		}
+	}
+	for( const auto dir : type_info.extra_dirs ) {
+		if( !dir.empty() ) {
+			fs::create_directories( project_dir / dir );
+		}
+	}
+	if( cfg.simd_dispatch ) {
+		install_simd_dispatch( cfg, installed_files );
+	}
+	if( cfg.profiling ) {
+		install_profiling( cfg, installed_files );
+	}
+	merge_snippets_recursive( project_dir );
+
+	if( cfg.dedupe != DedupeMode::none ) {
+		const DedupeStats stats = dedupe_tree( project_dir, cfg.dedupe_store, cfg.dedupe, published_dir );
+		std::cout << "Deduplicated " << stats.linked_files << " of " << stats.files << " files ("
+				  << stats.bytes_saved << " bytes saved)" << std::endl;
+	}
+}
+
+} // namespace
+
+void install_project( const Config& cfg )
+{
+	if( cfg.durability == Durability::none ) {
+		install_files( cfg, cfg.project_dir );
+		return;
+	}
+
+	// publish_directory would fail anyway, but only after everything has been generated and synced
+	if( fs::exists( cfg.project_dir ) && !fs::is_empty( cfg.project_dir ) ) {
+		throw std::runtime_error( "Project directory " + cfg.project_dir.string() + " already exists and is not empty" );
+	}
+
+	// Generate everything next to the final location, so a failure never leaves a half generated project behind
+	Config staged_cfg      = cfg;
+	staged_cfg.project_dir = create_staging_directory( cfg.project_dir );
+	try {
+		install_files( staged_cfg, cfg.project_dir );
+		make_durable( staged_cfg.project_dir, cfg.durability );
+		publish_directory( staged_cfg.project_dir, cfg.project_dir );
+	} catch( ... ) {
+		std::error_code ec;
+		fs::remove_all( staged_cfg.project_dir, ec );
+		throw;
+	}
+}
+
+} // namespace mba
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "config.h"
+
+namespace mba {
+
+// Generates the project described by cfg into cfg.project_dir, with the durability of cfg.durability:
+// for batch/strict it is generated into a staging directory, synced and then published with a single rename.
+// If anything fails, neither the project nor the staging directory is left behind.
+void install_project( const Config& cfg );
+
+} // namespace mba
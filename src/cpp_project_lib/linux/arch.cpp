@@ -1,11 +1,16 @@
 #include "../arch.h"
 
+#include <fcntl.h>
+#include <linux/fs.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/ioctl.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <cerrno>
 #include <filesystem>
+#include <system_error>
 
 namespace mba {
 // https://stackoverflow.com/questions/4031672/without-access-to-argv0-how-do-i-get-the-program-name
@@ -30,4 +35,65 @@ std::filesystem::path get_exec_directory()
 	return GetExeFileName().parent_path();
 }
 
+namespace {
+
+// opens the file read only, calls sync_function on the descriptor and throws on failure
+template<class F>
+void sync_with( const std::filesystem::path& path, int flags, F&& sync_function, const char* description )
+{
+	int fd = open( path.c_str(), O_RDONLY | O_CLOEXEC | flags );
+	if( fd == -1 ) {
+		throw std::system_error( errno, std::generic_category(), "Could not open " + path.string() );
+	}
+	int res = sync_function( fd );
+	int err = errno;
+	close( fd );
+	if( res == -1 ) {
+		throw std::system_error( err, std::generic_category(), description + path.string() );
+	}
+}
+
+} // namespace
+
+void sync_file( const std::filesystem::path& file )
+{
+	sync_with( file, 0, []( int fd ) { return fdatasync( fd ); }, "Could not sync file " );
+}
+
+void sync_directory( const std::filesystem::path& dir )
+{
+	sync_with( dir, O_DIRECTORY, []( int fd ) { return fsync( fd ); }, "Could not sync directory " );
+}
+
+void sync_filesystem( const std::filesystem::path& dir )
+{
+	sync_with( dir, O_DIRECTORY, []( int fd ) { return syncfs( fd ); }, "Could not sync file system of " );
+}
+
+bool reflink_file( const std::filesystem::path& from, const std::filesystem::path& to )
+{
+#if defined( FICLONE )
+	int src = open( from.c_str(), O_RDONLY | O_CLOEXEC );
+	if( src == -1 ) {
+		return false;
+	}
+	int dest = open( to.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644 );
+	if( dest == -1 ) {
+		close( src );
+		return false;
+	}
+	const bool ok = ioctl( dest, FICLONE, src ) == 0;
+	close( dest );
+	close( src );
+	if( !ok ) {
+		unlink( to.c_str() );
+	}
+	return ok;
+#else
+	(void)from;
+	(void)to;
+	return false;
+#endif
+}
+
 } // namespace mba
@@ -0,0 +1,222 @@
+#include "render.h"
+
+#include "variable_matchers.h"
+
+#include <algorithm>
+#include <array>
+#include <future>
+#include <iterator>
+#include <vector>
+
+namespace mba {
+
+void replace_inplace( std::string& src, const std::regex& reg, const std::string& replace )
+{
+	thread_local std::string buffer;
+	buffer.clear();
+	std::regex_replace( std::back_inserter( buffer ), src.begin(), src.end(), reg, replace );
+	src = buffer;
+}
+
+namespace {
+
+std::string_view cmake_public_visibility( const Config& cfg )
+{
+	return info( cfg.prj_type ).cmake_visibility;
+}
+
+std::string render_line_regex( std::string line, const Config& cfg )
+{
+	const Names& names = cfg.names;
+	replace_inplace( line, regex_prj, names.project );
+	replace_inplace( line, regex_target, names.target );
+	replace_inplace( line, regex_ns, names.ns );
+	replace_inplace( line, regex_link_target, names.cmake_link_target );
+	replace_inplace( line, regex_cmake_ns, names.cmake_ns );
+	replace_inplace( line, regex_cmake_public_visibility, std::string( cmake_public_visibility( cfg ) ) );
+	return line;
+}
+
+struct Placeholder {
+	std::string_view name;
+	std::string_view value;
+};
+
+using Placeholders = std::array<Placeholder, 6>;
+
+Placeholders make_placeholders( const Config& cfg )
+{
+	return {{{"PROJECT_NAME", cfg.names.project},
+			 {"TARGET_NAME", cfg.names.target},
+			 {"NAMESPACE", cfg.names.ns},
+			 {"CMAKE_TARGET_LINK_NAME", cfg.names.cmake_link_target},
+			 {"CMAKE_NAMESPACE", cfg.names.cmake_ns},
+			 {"CMAKE_PUBLIC_VISIBILITY", cmake_public_visibility( cfg )}}};
+}
+
+bool is_name_char( char c )
+{
+	return ( c >= 'A' && c <= 'Z' ) || c == '_';
+}
+
+// The reference replaces one placeholder after the other, so a substituted value can become part of a
+// placeholder that gets replaced in a later step. As long as the values are not empty and contain neither
+// '$' nor '{', this requires a "${$" in the template, followed by the beginning of a placeholder name and
+// the '$' of another placeholder. Overlapping placeholders ("...$}${$...") are also resolved differently.
+// Returns false in all those cases.
+bool render_single_pass_into( std::string_view text, const Placeholders& placeholders, std::string& out )
+{
+	for( const auto& p : placeholders ) {
+		if( p.value.empty() || p.value.find_first_of( "${" ) != std::string_view::npos ) {
+			return false;
+		}
+	}
+
+	constexpr std::string_view open  = "${$";
+	constexpr std::string_view close = "$}$";
+
+	std::size_t pos = 0;
+	while( true ) {
+		const std::size_t start = text.find( open, pos );
+		if( start == std::string_view::npos ) {
+			out.append( text.data() + pos, text.size() - pos );
+			return true;
+		}
+		out.append( text.data() + pos, start - pos );
+
+		std::size_t name_end = start + open.size();
+		while( name_end < text.size() && is_name_char( text[name_end] ) ) {
+			++name_end;
+		}
+		const std::string_view name = text.substr( start + open.size(), name_end - start - open.size() );
+
+		const Placeholder* match = nullptr;
+		if( text.substr( name_end, close.size() ) == close ) {
+			for( const auto& p : placeholders ) {
+				if( p.name == name ) {
+					match = &p;
+				}
+			}
+		}
+
+		if( match == nullptr ) {
+			if( name_end < text.size() && text[name_end] == '$' ) {
+				for( const auto& p : placeholders ) {
+					if( p.name.substr( 0, name.size() ) == name ) {
+						return false;
+					}
+				}
+			}
+			out.push_back( '$' );
+			pos = start + 1;
+			continue;
+		}
+
+		const std::size_t end = name_end + close.size();
+		if( text.substr( end - 1, open.size() ) == open ) {
+			return false;
+		}
+		out.append( match->value );
+		pos = end;
+	}
+}
+
+// renders text that consists of complete lines (or is the end of the input)
+void render_lines( std::string_view text, const Config& cfg, const Placeholders& placeholders, std::string& out )
+{
+	const std::size_t old_size = out.size();
+	if( !render_single_pass_into( text, placeholders, out ) ) {
+		out.resize( old_size );
+		out.append( render_regex( text, cfg ) );
+		return;
+	}
+	// the reference terminates every line, including an unterminated last one
+	if( !text.empty() && text.back() != '\n' ) {
+		out.push_back( '\n' );
+	}
+}
+
+} // namespace
+
+std::string render_regex( std::string_view text, const Config& cfg )
+{
+	std::string out;
+	std::size_t pos = 0;
+	while( pos < text.size() ) {
+		std::size_t line_end = text.find( '\n', pos );
+		if( line_end == std::string_view::npos ) {
+			line_end = text.size();
+		}
+		out.append( render_line_regex( std::string( text.substr( pos, line_end - pos ) ), cfg ) );
+		out.push_back( '\n' );
+		pos = line_end + 1;
+	}
+	return out;
+}
+
+std::string render_single_pass( std::string_view text, const Config& cfg )
+{
+	std::string out;
+	out.reserve( text.size() + text.size() / 8 );
+	render_lines( text, cfg, make_placeholders( cfg ), out );
+	return out;
+}
+
+void render_streaming( std::istream& in, std::ostream& out, const Config& cfg )
+{
+	const Placeholders placeholders = make_placeholders( cfg );
+
+	std::vector<char> chunk( 64 * 1024 );
+	std::string       pending; // begin of a line that continues in the next chunk
+	std::string       rendered;
+	while( in ) {
+		in.read( chunk.data(), static_cast<std::streamsize>( chunk.size() ) );
+		pending.append( chunk.data(), static_cast<std::size_t>( in.gcount() ) );
+
+		const std::size_t last_newline = pending.rfind( '\n' );
+		if( last_newline == std::string::npos ) {
+			continue;
+		}
+		rendered.clear();
+		render_lines( std::string_view( pending ).substr( 0, last_newline + 1 ), cfg, placeholders, rendered );
+		out.write( rendered.data(), static_cast<std::streamsize>( rendered.size() ) );
+		pending.erase( 0, last_newline + 1 );
+	}
+	rendered.clear();
+	render_lines( pending, cfg, placeholders, rendered );
+	out.write( rendered.data(), static_cast<std::streamsize>( rendered.size() ) );
+}
+
+std::string render_parallel( std::string_view text, const Config& cfg, unsigned thread_count )
+{
+	const Placeholders placeholders = make_placeholders( cfg );
+
+	// split into parts of roughly equal size, each ending after a '\n' (except for the last one)
+	std::vector<std::string_view> parts;
+	const std::size_t             target_size = text.size() / std::max( thread_count, 1u ) + 1;
+	std::size_t                   pos         = 0;
+	while( pos < text.size() ) {
+		std::size_t end = text.find( '\n', std::min( pos + target_size, text.size() ) - 1 );
+		end             = end == std::string_view::npos ? text.size() : end + 1;
+		parts.push_back( text.substr( pos, end - pos ) );
+		pos = end;
+	}
+
+	std::vector<std::future<std::string>> results;
+	for( std::string_view part : parts ) {
+		results.push_back( std::async( std::launch::async, [&cfg, &placeholders, part] {
+			std::string out;
+			render_lines( part, cfg, placeholders, out );
+			return out;
+		} ) );
+	}
+
+	std::string out;
+	out.reserve( text.size() + text.size() / 8 );
+	for( auto& result : results ) {
+		out.append( result.get() );
+	}
+	return out;
+}
+
+} // namespace mba
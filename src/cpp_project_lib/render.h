@@ -0,0 +1,32 @@
+#pragma once
+
+#include "config.h"
+
+#include <istream>
+#include <ostream>
+#include <regex>
+#include <string>
+#include <string_view>
+
+namespace mba {
+
+void replace_inplace( std::string& src, const std::regex& reg, const std::string& replace );
+
+// All functions below replace the ${$...$}$ placeholders of a template with the values from cfg
+// and produce exactly the same output (every line, including the last one, ends with '\n').
+
+// Reference implementation: one std::regex_replace per placeholder, line by line
+std::string render_regex( std::string_view text, const Config& cfg );
+
+// Replaces all placeholders in a single scan over the text.
+// Text for which that could differ from the reference (e.g. a value that contains '$' or a template
+// that could assemble a new placeholder from a substituted value) is handed to render_regex instead.
+std::string render_single_pass( std::string_view text, const Config& cfg );
+
+// Like render_single_pass, but processes the input in chunks of complete lines
+void render_streaming( std::istream& in, std::ostream& out, const Config& cfg );
+
+// Splits the text at line boundaries and renders the parts concurrently
+std::string render_parallel( std::string_view text, const Config& cfg, unsigned thread_count );
+
+} // namespace mba
@@ -0,0 +1,71 @@
+#include "staging.h"
+
+#include "arch.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace mba {
+
+namespace fs = std::filesystem;
+
+fs::path create_staging_directory( const fs::path& project_dir )
+{
+	// a random suffix keeps concurrent runs for the same project apart
+	std::random_device                           rd;
+	std::uniform_int_distribution<std::uint64_t> dist;
+	const std::string                            prefix = "." + project_dir.filename().u8string() + ".staging-";
+	fs::create_directories( project_dir.parent_path() );
+	while( true ) {
+		char suffix[17];
+		std::snprintf( suffix, sizeof( suffix ), "%016llx", static_cast<unsigned long long>( dist( rd ) ) );
+		const fs::path dir = project_dir.parent_path() / ( prefix + suffix );
+		if( fs::create_directory( dir ) ) {
+			return dir;
+		}
+	}
+}
+
+void make_durable( const fs::path& dir, Durability durability )
+{
+	switch( durability ) {
+		case Durability::none: break;
+		case Durability::batch: sync_filesystem( dir ); break;
+		case Durability::strict:
+			for( const auto& entry : fs::recursive_directory_iterator( dir ) ) {
+				if( entry.is_directory() ) {
+					sync_directory( entry.path() );
+				} else {
+					sync_file( entry.path() );
+				}
+			}
+			sync_directory( dir );
+			break;
+	}
+}
+
+void publish_directory( const fs::path& staging_dir, const fs::path& project_dir )
+{
+	// rename can only replace empty directories (and not at all on windows)
+	if( fs::is_directory( project_dir ) && fs::is_empty( project_dir ) ) {
+		fs::remove( project_dir );
+	}
+
+	std::error_code ec;
+	fs::rename( staging_dir, project_dir, ec );
+	if( ec ) {
+		throw std::runtime_error( "Could not publish project to " + project_dir.string()
+								  + " (the directory has to be empty or must not exist): " + ec.message() );
+	}
+
+	// makes the rename itself durable
+	const fs::path parent = project_dir.parent_path();
+	sync_directory( parent.empty() ? fs::path( "." ) : parent );
+}
+
+} // namespace mba
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Durability.h"
+
+#include <filesystem>
+
+namespace mba {
+
+// Creates a new, uniquely named sibling of project_dir into which the project gets generated before it is published
+std::filesystem::path create_staging_directory( const std::filesystem::path& project_dir );
+
+// Flushes all files below dir to the disk (does nothing for Durability::none)
+void make_durable( const std::filesystem::path& dir, Durability durability );
+
+// Moves staging_dir to project_dir with a single rename
+// project_dir may not exist or has to be empty, otherwise an exception is thrown
+void publish_directory( const std::filesystem::path& staging_dir, const std::filesystem::path& project_dir );
+
+} // namespace mba
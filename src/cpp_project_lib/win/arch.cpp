@@ -1,6 +1,8 @@
 #include "../arch.h"
 
+#include <stdexcept>
 #include <string>
+#include <system_error>
 #include <windows.h>
 
 namespace mba {
@@ -28,4 +30,58 @@ std::filesystem::path get_exec_directory()
 	return GetExeFileName().parent_path();
 }
 
+void sync_file( const std::filesystem::path& file )
+{
+	// FlushFileBuffers needs a handle with write access, which can't be opened for read-only files
+	// (e.g. hard links into the dedupe store). So the attribute is removed while the handle is opened.
+	const DWORD attributes = GetFileAttributesW( file.c_str() );
+	const bool  read_only  = attributes != INVALID_FILE_ATTRIBUTES && ( attributes & FILE_ATTRIBUTE_READONLY ) != 0;
+	if( read_only && !SetFileAttributesW( file.c_str(), attributes & ~FILE_ATTRIBUTE_READONLY ) ) {
+		throw std::system_error(
+			(int)GetLastError(), std::system_category(), "Could not make " + file.string() + " writable" );
+	}
+
+	HANDLE handle = CreateFileW( file.c_str(),
+								 GENERIC_WRITE,
+								 FILE_SHARE_READ | FILE_SHARE_WRITE,
+								 NULL,
+								 OPEN_EXISTING,
+								 FILE_ATTRIBUTE_NORMAL,
+								 NULL );
+	const DWORD open_error = GetLastError();
+	if( read_only ) {
+		SetFileAttributesW( file.c_str(), attributes );
+	}
+	if( handle == INVALID_HANDLE_VALUE ) {
+		throw std::system_error( (int)open_error, std::system_category(), "Could not open " + file.string() );
+	}
+	const BOOL  ok  = FlushFileBuffers( handle );
+	const DWORD err = GetLastError();
+	CloseHandle( handle );
+	if( !ok ) {
+		throw std::system_error( (int)err, std::system_category(), "Could not sync file " + file.string() );
+	}
+}
+
+void sync_directory( const std::filesystem::path& )
+{
+	// NTFS journals directory changes itself, there is nothing to flush
+}
+
+void sync_filesystem( const std::filesystem::path& dir )
+{
+	// there is no equivalent to syncfs, so flush the files one by one
+	for( const auto& entry : std::filesystem::recursive_directory_iterator( dir ) ) {
+		if( entry.is_regular_file() ) {
+			sync_file( entry.path() );
+		}
+	}
+}
+
+bool reflink_file( const std::filesystem::path&, const std::filesystem::path& )
+{
+	// block cloning only exists on ReFS and needs a lot of ceremony, just keep the copies
+	return false;
+}
+
 } // namespace mba
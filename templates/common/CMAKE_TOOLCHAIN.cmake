@@ -0,0 +1,48 @@
+########## Build acceleration ################################################
+# Use a compiler cache (ccache/sccache) and a faster linker (mold/lld) when they are installed
+
+option( ${$PROJECT_NAME$}$_USE_COMPILER_CACHE "Use ccache or sccache when available" ON )
+option( ${$PROJECT_NAME$}$_USE_FAST_LINKER "Use mold or lld when available" ON )
+
+set( ${$PROJECT_NAME$}$_compiler_cache "none" )
+set( ${$PROJECT_NAME$}$_linker "default" )
+
+# msvc writes the debug info of all files into a shared pdb, which compiler caches can't handle
+if( ${$PROJECT_NAME$}$_USE_COMPILER_CACHE AND NOT MSVC )
+	if( CMAKE_CXX_COMPILER_LAUNCHER )
+		set( ${$PROJECT_NAME$}$_compiler_cache "${CMAKE_CXX_COMPILER_LAUNCHER} (user provided)" )
+	else()
+		find_program( ${$PROJECT_NAME$}$_COMPILER_CACHE_PROGRAM NAMES ccache sccache )
+		if( ${$PROJECT_NAME$}$_COMPILER_CACHE_PROGRAM )
+			set( CMAKE_CXX_COMPILER_LAUNCHER "${${$PROJECT_NAME$}$_COMPILER_CACHE_PROGRAM}" )
+			set( ${$PROJECT_NAME$}$_compiler_cache "${${$PROJECT_NAME$}$_COMPILER_CACHE_PROGRAM}" )
+		endif()
+	endif()
+endif()
+
+if( ${$PROJECT_NAME$}$_USE_FAST_LINKER AND NOT MSVC AND NOT CMAKE_LINKER_TYPE )
+	include( CheckCXXSourceCompiles )
+	foreach( linker mold lld )
+		# not every compiler version supports every linker, so check that linking actually works
+		set( CMAKE_REQUIRED_FLAGS "-fuse-ld=${linker}" )
+		set( CMAKE_REQUIRED_QUIET ON )
+		check_cxx_source_compiles( "int main() { return 0; }" ${$PROJECT_NAME$}$_HAS_LINKER_${linker} )
+		unset( CMAKE_REQUIRED_FLAGS )
+		unset( CMAKE_REQUIRED_QUIET )
+
+		if( ${$PROJECT_NAME$}$_HAS_LINKER_${linker} )
+			if( CMAKE_VERSION VERSION_GREATER_EQUAL 3.29 )
+				string( TOUPPER ${linker} CMAKE_LINKER_TYPE )
+			else()
+				foreach( kind EXE SHARED MODULE )
+					string( APPEND CMAKE_${kind}_LINKER_FLAGS " -fuse-ld=${linker}" )
+				endforeach()
+			endif()
+			set( ${$PROJECT_NAME$}$_linker ${linker} )
+			break()
+		endif()
+	endforeach()
+endif()
+
+message( STATUS "${PROJECT_NAME} compiler cache: ${${$PROJECT_NAME$}$_compiler_cache}" )
+message( STATUS "${PROJECT_NAME} linker:         ${${$PROJECT_NAME$}$_linker}" )
\ No newline at end of file
@@ -0,0 +1 @@
+	cxx_std_17
\ No newline at end of file
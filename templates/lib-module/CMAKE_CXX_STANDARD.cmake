@@ -0,0 +1 @@
+	cxx_std_20
\ No newline at end of file
@@ -0,0 +1 @@
+add_library( ${$TARGET_NAME$}$ )
\ No newline at end of file
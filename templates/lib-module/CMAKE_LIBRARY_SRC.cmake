@@ -0,0 +1,18 @@
+# C++20 modules are only supported by the Ninja and Visual Studio generators (not by the Makefile generators)
+if( NOT CMAKE_GENERATOR MATCHES "^(Ninja|Visual Studio)" )
+	message( FATAL_ERROR
+		"C++20 modules can't be built with the \"${CMAKE_GENERATOR}\" generator. "
+		"Use Ninja (cmake -G Ninja <Project directory>, or one of the presets) or Visual Studio." )
+endif()
+
+file( GLOB_RECURSE SOURCE_FILES CONFIGURE_DEPENDS "src/*.cpp" "src/*.hpp" )
+target_sources(
+	${$TARGET_NAME$}$
+PRIVATE
+	${SOURCE_FILES}
+	# add further source files here
+PUBLIC
+	FILE_SET CXX_MODULES
+	FILES
+		src/${$TARGET_NAME$}$.cppm
+)
\ No newline at end of file
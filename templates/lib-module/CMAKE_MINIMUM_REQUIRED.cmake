@@ -0,0 +1 @@
+cmake_minimum_required( VERSION 3.28 )
\ No newline at end of file
@@ -0,0 +1,13 @@
+module;
+
+// The module re-exports the declarations from the regular header,
+// so consumers that still #include it keep working
+#include "../include/${$TARGET_NAME$}$/${$TARGET_NAME$}$.hpp"
+
+export module ${$NAMESPACE$}$;
+
+export namespace ${$NAMESPACE$}$ {
+
+using ${$NAMESPACE$}$::hello;
+
+} // namespace ${$NAMESPACE$}$
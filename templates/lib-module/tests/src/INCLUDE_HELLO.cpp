@@ -0,0 +1 @@
+import ${$NAMESPACE$}$;
\ No newline at end of file
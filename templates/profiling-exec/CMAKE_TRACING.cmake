@@ -0,0 +1,3 @@
+if( ${$PROJECT_NAME$}$_ENABLE_TRACING )
+	add_definitions( -D${$PROJECT_NAME$}$_ENABLE_TRACING )
+endif()
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include "util.hpp"
+
+#include "trace.hpp"
+
+namespace ${$NAMESPACE$}$ {
+
+	const char* hello()
+	{
+		${$PROJECT_NAME$}$_TRACE_FUNCTION();
+		return "Hello World";
+	}
+
+} // namespace ${$NAMESPACE$}$
\ No newline at end of file
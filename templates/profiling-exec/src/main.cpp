@@ -0,0 +1,16 @@
+// Project includes
+#include <${$TARGET_NAME$}$_lib/trace.hpp>
+#include <${$TARGET_NAME$}$_lib/util.hpp>
+
+// Third party library includes
+
+// Standard library includes
+
+#include <iostream>
+
+using namespace ${$NAMESPACE$}$;
+
+int main() {
+	${$PROJECT_NAME$}$_TRACE_FUNCTION();
+	std::cout << hello() << "\n";
+}
\ No newline at end of file
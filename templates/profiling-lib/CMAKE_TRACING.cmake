@@ -0,0 +1,5 @@
+
+if( ${$PROJECT_NAME$}$_ENABLE_TRACING )
+	# trace.hpp is a public header: consumers need the same definition, otherwise the macros compile differently
+	target_compile_definitions( ${$TARGET_NAME$}$ ${$CMAKE_PUBLIC_VISIBILITY$}$ ${$PROJECT_NAME$}$_ENABLE_TRACING )
+endif()
\ No newline at end of file
@@ -0,0 +1,17 @@
+########## Profiling #########################################################
+option( ${$PROJECT_NAME$}$_ENABLE_TRACING "Record trace zones and write ${$PROJECT_NAME$}$_trace.json on exit" OFF )
+# the ${$PROJECT_NAME$}$_ENABLE_TRACING definition is added further down (public for libraries)
+
+# Profiling configuration: RelWithDebInfo that keeps the frame pointers, so perf & co. get usable call stacks
+# ( e.g. cmake -DCMAKE_BUILD_TYPE=Profiling <project dir> )
+if( MSVC )
+	set( CMAKE_CXX_FLAGS_PROFILING "${CMAKE_CXX_FLAGS_RELWITHDEBINFO} /Oy-" )
+else()
+	set( CMAKE_CXX_FLAGS_PROFILING "${CMAKE_CXX_FLAGS_RELWITHDEBINFO} -fno-omit-frame-pointer" )
+endif()
+set( CMAKE_EXE_LINKER_FLAGS_PROFILING "${CMAKE_EXE_LINKER_FLAGS_RELWITHDEBINFO}" )
+set( CMAKE_SHARED_LINKER_FLAGS_PROFILING "${CMAKE_SHARED_LINKER_FLAGS_RELWITHDEBINFO}" )
+
+if( CMAKE_CONFIGURATION_TYPES AND NOT "Profiling" IN_LIST CMAKE_CONFIGURATION_TYPES )
+	list( APPEND CMAKE_CONFIGURATION_TYPES Profiling )
+endif()
\ No newline at end of file
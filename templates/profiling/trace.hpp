@@ -0,0 +1,218 @@
+#pragma once
+
+// Minimal tracer for scoped zones:
+//
+//     void work()
+//     {
+//         ${$PROJECT_NAME$}$_TRACE_FUNCTION();
+//         ...
+//         {
+//             ${$PROJECT_NAME$}$_TRACE_SCOPE( "inner loop" );
+//             ...
+//         }
+//     }
+//
+// Every thread records into its own lock-free buffer. On program exit all zones are written to
+// ${$PROJECT_NAME$}$_trace.json (chrome trace format, open with chrome://tracing or ui.perfetto.dev).
+// The buffers are only emptied on exit, so each thread records its first
+// ${$PROJECT_NAME$}$_TRACE_MAX_EVENTS_PER_THREAD zones (default 65536) and drops the rest.
+// For long runs, trace a shorter part of the program or raise the limit (memory: 24 bytes per event).
+// Zone names have to be string literals (only the pointer is stored).
+// Unless ${$PROJECT_NAME$}$_ENABLE_TRACING is defined (cmake option of the same name), the macros compile to nothing.
+
+#if defined( ${$PROJECT_NAME$}$_ENABLE_TRACING )
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if !defined( ${$PROJECT_NAME$}$_TRACE_MAX_EVENTS_PER_THREAD )
+#define ${$PROJECT_NAME$}$_TRACE_MAX_EVENTS_PER_THREAD 65536
+#endif
+
+namespace ${$NAMESPACE$}$::trace {
+
+struct Event {
+	const char*   name;
+	std::int64_t  begin_ns;
+	std::int64_t  end_ns;
+};
+
+// Single producer (the owning thread) / single consumer (the exporter) queue.
+// When it is full, new events are dropped instead of blocking the traced thread or overwriting older events.
+class ThreadBuffer {
+public:
+	static constexpr std::uint64_t capacity = ${$PROJECT_NAME$}$_TRACE_MAX_EVENTS_PER_THREAD;
+
+	explicit ThreadBuffer( std::uint32_t tid )
+		: _events( capacity )
+		, _tid( tid )
+	{
+	}
+
+	void push( const Event& event ) noexcept
+	{
+		const std::uint64_t head = _head.load( std::memory_order_relaxed );
+		if( head - _tail.load( std::memory_order_acquire ) == capacity ) {
+			_dropped.fetch_add( 1, std::memory_order_relaxed );
+			return;
+		}
+		_events[head % capacity] = event;
+		_head.store( head + 1, std::memory_order_release );
+	}
+
+	template<class F>
+	void drain( F&& f )
+	{
+		std::uint64_t       tail = _tail.load( std::memory_order_relaxed );
+		const std::uint64_t head = _head.load( std::memory_order_acquire );
+		for( ; tail != head; ++tail ) {
+			f( _events[tail % capacity] );
+		}
+		_tail.store( tail, std::memory_order_release );
+	}
+
+	std::uint32_t tid() const noexcept { return _tid; }
+	std::uint64_t dropped() const noexcept { return _dropped.load( std::memory_order_relaxed ); }
+
+private:
+	std::vector<Event> _events;
+
+	alignas( 64 ) std::atomic<std::uint64_t> _head{ 0 };
+	alignas( 64 ) std::atomic<std::uint64_t> _tail{ 0 };
+
+	std::atomic<std::uint64_t> _dropped{ 0 };
+	std::uint32_t              _tid;
+};
+
+// Owns the buffers of all threads (so they survive thread exit) and exports them on destruction
+class Registry {
+public:
+	Registry()
+		: _start( std::chrono::steady_clock::now() )
+	{
+	}
+
+	~Registry() { write_chrome_trace( "${$PROJECT_NAME$}$_trace.json" ); }
+
+	// only called once per thread
+	std::shared_ptr<ThreadBuffer> add_thread()
+	{
+		std::lock_guard<std::mutex> lock( _mutex );
+		_buffers.push_back( std::make_shared<ThreadBuffer>( static_cast<std::uint32_t>( _buffers.size() ) ) );
+		return _buffers.back();
+	}
+
+	std::int64_t now_ns() const noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - _start )
+			.count();
+	}
+
+	void write_chrome_trace( const char* file_name )
+	{
+		std::lock_guard<std::mutex> lock( _mutex );
+
+		std::ofstream out( file_name, std::ios::out | std::ios::trunc );
+		if( !out ) {
+			std::cerr << "Could not write trace file " << file_name << std::endl;
+			return;
+		}
+
+		std::uint64_t dropped = 0;
+		bool          first   = true;
+		// microseconds with ns resolution (the default precision would round to 6 significant digits)
+		out << std::fixed << std::setprecision( 3 );
+		out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		for( const auto& buffer : _buffers ) {
+			buffer->drain( [&]( const Event& e ) {
+				out << ( first ? "\n" : ",\n" ) << "{\"name\":\"";
+				write_escaped( out, e.name );
+				out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid() << ",\"ts\":" << e.begin_ns / 1000.0
+					<< ",\"dur\":" << ( e.end_ns - e.begin_ns ) / 1000.0 << "}";
+				first = false;
+			} );
+			dropped += buffer->dropped();
+		}
+		out << "\n]}\n";
+
+		if( dropped > 0 ) {
+			std::cerr << "Tracing: " << dropped << " events were dropped because a buffer was full (only the first "
+					  << ThreadBuffer::capacity << " zones of each thread are recorded)" << std::endl;
+		}
+	}
+
+private:
+	static void write_escaped( std::ostream& out, const char* str )
+	{
+		for( ; *str != '\0'; ++str ) {
+			if( *str == '"' || *str == '\\' ) {
+				out.put( '\\' );
+			}
+			out.put( *str );
+		}
+	}
+
+	std::chrono::steady_clock::time_point      _start;
+	std::mutex                                 _mutex;
+	std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+};
+
+inline Registry& registry()
+{
+	static Registry instance;
+	return instance;
+}
+
+inline ThreadBuffer& this_thread_buffer()
+{
+	thread_local const std::shared_ptr<ThreadBuffer> buffer = registry().add_thread();
+	return *buffer;
+}
+
+class Zone {
+public:
+	// The buffer is looked up first, so that registering a new thread isn't part of the measured time
+	explicit Zone( const char* name ) noexcept
+		: _buffer( this_thread_buffer() )
+		, _name( name )
+		, _begin_ns( registry().now_ns() )
+	{
+	}
+
+	~Zone()
+	{
+		const std::int64_t end_ns = registry().now_ns();
+		_buffer.push( Event{ _name, _begin_ns, end_ns } );
+	}
+
+	Zone( const Zone& ) = delete;
+	Zone& operator=( const Zone& ) = delete;
+
+private:
+	ThreadBuffer& _buffer;
+	const char*   _name;
+	std::int64_t  _begin_ns;
+};
+
+} // namespace ${$NAMESPACE$}$::trace
+
+#define ${$PROJECT_NAME$}$_TRACE_CONCAT_IMPL( a, b ) a##b
+#define ${$PROJECT_NAME$}$_TRACE_CONCAT( a, b ) ${$PROJECT_NAME$}$_TRACE_CONCAT_IMPL( a, b )
+
+#define ${$PROJECT_NAME$}$_TRACE_SCOPE( name )                                                                       \
+	const ::${$NAMESPACE$}$::trace::Zone ${$PROJECT_NAME$}$_TRACE_CONCAT( trace_zone_, __LINE__ ) { name }
+#define ${$PROJECT_NAME$}$_TRACE_FUNCTION() ${$PROJECT_NAME$}$_TRACE_SCOPE( __func__ )
+
+#else
+
+#define ${$PROJECT_NAME$}$_TRACE_SCOPE( name ) static_cast<void>( 0 )
+#define ${$PROJECT_NAME$}$_TRACE_FUNCTION() static_cast<void>( 0 )
+
+#endif
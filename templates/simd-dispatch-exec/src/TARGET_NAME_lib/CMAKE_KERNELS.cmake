@@ -0,0 +1 @@
+include( kernels/kernels.cmake )
\ No newline at end of file
@@ -0,0 +1 @@
+#include <${$TARGET_NAME$}$_lib/kernels/kernels.hpp>
\ No newline at end of file
@@ -0,0 +1 @@
+include( src/kernels/kernels.cmake )
\ No newline at end of file
@@ -0,0 +1 @@
+#include "../../src/kernels/kernels.hpp"
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "kernels.hpp"
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#endif
+
+namespace ${$NAMESPACE$}$::kernels::detail {
+
+#if defined( __AVX2__ )
+
+namespace {
+
+void add_avx2( const float* a, const float* b, float* out, std::size_t n )
+{
+	std::size_t i = 0;
+	for( ; i + 8 <= n; i += 8 ) {
+		_mm256_storeu_ps( out + i, _mm256_add_ps( _mm256_loadu_ps( a + i ), _mm256_loadu_ps( b + i ) ) );
+	}
+	for( ; i < n; ++i ) {
+		out[i] = a[i] + b[i];
+	}
+}
+
+} // namespace
+
+add_fn add_avx2_kernel()
+{
+	return &add_avx2;
+}
+
+#else
+
+add_fn add_avx2_kernel()
+{
+	return nullptr;
+}
+
+#endif
+
+} // namespace ${$NAMESPACE$}$::kernels::detail
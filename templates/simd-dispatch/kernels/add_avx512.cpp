@@ -0,0 +1,40 @@
+#include "kernels.hpp"
+
+#if defined( __AVX512F__ )
+#include <immintrin.h>
+#endif
+
+namespace ${$NAMESPACE$}$::kernels::detail {
+
+#if defined( __AVX512F__ )
+
+namespace {
+
+void add_avx512( const float* a, const float* b, float* out, std::size_t n )
+{
+	std::size_t i = 0;
+	for( ; i + 16 <= n; i += 16 ) {
+		_mm512_storeu_ps( out + i, _mm512_add_ps( _mm512_loadu_ps( a + i ), _mm512_loadu_ps( b + i ) ) );
+	}
+	for( ; i < n; ++i ) {
+		out[i] = a[i] + b[i];
+	}
+}
+
+} // namespace
+
+add_fn add_avx512_kernel()
+{
+	return &add_avx512;
+}
+
+#else
+
+add_fn add_avx512_kernel()
+{
+	return nullptr;
+}
+
+#endif
+
+} // namespace ${$NAMESPACE$}$::kernels::detail
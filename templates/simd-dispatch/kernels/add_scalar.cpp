@@ -0,0 +1,21 @@
+#include "kernels.hpp"
+
+namespace ${$NAMESPACE$}$::kernels::detail {
+
+namespace {
+
+void add_scalar( const float* a, const float* b, float* out, std::size_t n )
+{
+	for( std::size_t i = 0; i < n; ++i ) {
+		out[i] = a[i] + b[i];
+	}
+}
+
+} // namespace
+
+add_fn add_scalar_kernel()
+{
+	return &add_scalar;
+}
+
+} // namespace ${$NAMESPACE$}$::kernels::detail
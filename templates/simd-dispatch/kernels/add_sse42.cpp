@@ -0,0 +1,40 @@
+#include "kernels.hpp"
+
+#if defined( __SSE4_2__ ) || ( defined( _MSC_VER ) && defined( _M_X64 ) )
+#include <nmmintrin.h>
+#endif
+
+namespace ${$NAMESPACE$}$::kernels::detail {
+
+#if defined( __SSE4_2__ ) || ( defined( _MSC_VER ) && defined( _M_X64 ) )
+
+namespace {
+
+void add_sse42( const float* a, const float* b, float* out, std::size_t n )
+{
+	std::size_t i = 0;
+	for( ; i + 4 <= n; i += 4 ) {
+		_mm_storeu_ps( out + i, _mm_add_ps( _mm_loadu_ps( a + i ), _mm_loadu_ps( b + i ) ) );
+	}
+	for( ; i < n; ++i ) {
+		out[i] = a[i] + b[i];
+	}
+}
+
+} // namespace
+
+add_fn add_sse42_kernel()
+{
+	return &add_sse42;
+}
+
+#else
+
+add_fn add_sse42_kernel()
+{
+	return nullptr;
+}
+
+#endif
+
+} // namespace ${$NAMESPACE$}$::kernels::detail
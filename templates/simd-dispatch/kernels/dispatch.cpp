@@ -0,0 +1,105 @@
+#include "kernels.hpp"
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace ${$NAMESPACE$}$::kernels {
+
+namespace {
+
+bool cpu_supports( Isa isa )
+{
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+	__builtin_cpu_init();
+	switch( isa ) {
+		case Isa::scalar: return true;
+		case Isa::sse42: return __builtin_cpu_supports( "sse4.2" );
+		case Isa::avx2: return __builtin_cpu_supports( "avx2" );
+		case Isa::avx512: return __builtin_cpu_supports( "avx512f" );
+	}
+	return false;
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+	int regs[4] = {};
+	__cpuid( regs, 1 );
+	const bool sse42   = ( regs[2] & ( 1 << 20 ) ) != 0;
+	const bool osxsave = ( regs[2] & ( 1 << 27 ) ) != 0;
+	// the os has to save the ymm (and zmm) registers on context switches
+	const unsigned long long xcr0 = osxsave ? _xgetbv( 0 ) : 0;
+
+	__cpuidex( regs, 7, 0 );
+	const bool avx2   = ( regs[1] & ( 1 << 5 ) ) != 0 && ( xcr0 & 0x06 ) == 0x06;
+	const bool avx512 = ( regs[1] & ( 1 << 16 ) ) != 0 && ( xcr0 & 0xE6 ) == 0xE6;
+	switch( isa ) {
+		case Isa::scalar: return true;
+		case Isa::sse42: return sse42;
+		case Isa::avx2: return avx2;
+		case Isa::avx512: return avx512;
+	}
+	return false;
+#else
+	return isa == Isa::scalar;
+#endif
+}
+
+struct Dispatch {
+	Isa    isa;
+	add_fn add;
+};
+
+Dispatch resolve()
+{
+	const Isa by_preference[] = {Isa::avx512, Isa::avx2, Isa::sse42};
+	for( Isa isa : by_preference ) {
+		if( add_fn kernel = get_add_kernel( isa ) ) {
+			return {isa, kernel};
+		}
+	}
+	return {Isa::scalar, detail::add_scalar_kernel()};
+}
+
+const Dispatch& dispatch()
+{
+	static const Dispatch d = resolve();
+	return d;
+}
+
+} // namespace
+
+const char* to_string( Isa isa )
+{
+	switch( isa ) {
+		case Isa::scalar: return "scalar";
+		case Isa::sse42: return "sse4.2";
+		case Isa::avx2: return "avx2";
+		case Isa::avx512: return "avx512";
+	}
+	return "unknown";
+}
+
+add_fn get_add_kernel( Isa isa )
+{
+	if( !cpu_supports( isa ) ) {
+		return nullptr;
+	}
+	switch( isa ) {
+		case Isa::scalar: return detail::add_scalar_kernel();
+		case Isa::sse42: return detail::add_sse42_kernel();
+		case Isa::avx2: return detail::add_avx2_kernel();
+		case Isa::avx512: return detail::add_avx512_kernel();
+	}
+	return nullptr;
+}
+
+Isa selected_isa()
+{
+	return dispatch().isa;
+}
+
+void add( const float* a, const float* b, float* out, std::size_t n )
+{
+	dispatch().add( a, b, out, n );
+}
+
+} // namespace ${$NAMESPACE$}$::kernels
@@ -0,0 +1,27 @@
+########## SIMD kernels ######################################################
+# Each add_<isa>.cpp is compiled with its own instruction set flags.
+# The dispatcher (dispatch.cpp) is compiled for the baseline and only calls
+# a kernel after checking that the cpu supports it.
+# Keep the kernel files free of inline functions shared with other files:
+# the linker might otherwise pick a copy that was compiled for a newer isa.
+
+if( CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|x86|i[3-6]86)$" )
+	if( MSVC )
+		# x64 always provides sse4.2 intrinsics, there is no separate switch
+		set( KERNEL_FLAGS_sse42 "" )
+		set( KERNEL_FLAGS_avx2 "/arch:AVX2" )
+		set( KERNEL_FLAGS_avx512 "/arch:AVX512" )
+	else()
+		set( KERNEL_FLAGS_sse42 "-msse4.2" )
+		set( KERNEL_FLAGS_avx2 "-mavx2" )
+		set( KERNEL_FLAGS_avx512 "-mavx512f" )
+	endif()
+
+	foreach( isa sse42 avx2 avx512 )
+		set_source_files_properties(
+			${CMAKE_CURRENT_LIST_DIR}/add_${isa}.cpp
+		PROPERTIES
+			COMPILE_OPTIONS "${KERNEL_FLAGS_${isa}}"
+		)
+	endforeach()
+endif()
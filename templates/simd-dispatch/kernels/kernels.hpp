@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ${$NAMESPACE$}$::kernels {
+
+enum class Isa { scalar, sse42, avx2, avx512 };
+
+const char* to_string( Isa isa );
+
+using add_fn = void ( * )( const float* a, const float* b, float* out, std::size_t n );
+
+// out[i] = a[i] + b[i] using the best instruction set supported by the cpu
+void add( const float* a, const float* b, float* out, std::size_t n );
+
+// instruction set picked by the dispatcher (resolved once, on first use)
+Isa selected_isa();
+
+// kernel for a specific instruction set
+// returns nullptr if the kernel was not compiled in or the cpu doesn't support it
+add_fn get_add_kernel( Isa isa );
+
+namespace detail {
+// each of those is implemented in its own translation unit compiled with the matching isa flags
+// and returns nullptr if the compiler didn't target that instruction set
+add_fn add_scalar_kernel();
+add_fn add_sse42_kernel();
+add_fn add_avx2_kernel();
+add_fn add_avx512_kernel();
+} // namespace detail
+
+} // namespace ${$NAMESPACE$}$::kernels
@@ -0,0 +1,8 @@
+
+########## Generate kernel benchmark (not run by ctest) ######################
+option( ${$PROJECT_NAME$}$_BUILD_BENCHMARKS "Build the kernel benchmark" OFF )
+
+if( ${$PROJECT_NAME$}$_BUILD_BENCHMARKS )
+	add_executable( ${$TARGET_NAME$}$_kernels_benchmark src/bench_kernels.cpp )
+	target_link_libraries( ${$TARGET_NAME$}$_kernels_benchmark PRIVATE ${$CMAKE_TARGET_LINK_NAME$}$ )
+endif()
@@ -0,0 +1,46 @@
+${$SNIPP_$INCLUDE_KERNELS.cpp$$}$
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+// Not part of the tests (and ctest). Build with
+//     -D${$PROJECT_NAME$}$_INCLUDE_TESTS=ON -D${$PROJECT_NAME$}$_BUILD_BENCHMARKS=ON
+// and run ${$TARGET_NAME$}$_kernels_benchmark
+
+using namespace ${$NAMESPACE$}$::kernels;
+
+int main()
+{
+	// small enough to stay in the L1/L2 cache, otherwise all kernels just measure memory bandwidth
+	constexpr std::size_t n          = 4096;
+	constexpr int         iterations = 100000;
+
+	std::vector<float> a( n );
+	std::vector<float> b( n );
+	std::vector<float> out( n );
+	for( std::size_t i = 0; i < n; ++i ) {
+		a[i] = static_cast<float>( i ) * 0.5f + 1.0f;
+		b[i] = static_cast<float>( i ) * 0.5f + 2.0f;
+	}
+
+	std::cout << "Selected kernel: " << to_string( selected_isa() ) << std::endl;
+	const Isa all_isas[] = {Isa::scalar, Isa::sse42, Isa::avx2, Isa::avx512};
+	for( Isa isa : all_isas ) {
+		const add_fn kernel = get_add_kernel( isa );
+		if( kernel == nullptr ) {
+			continue;
+		}
+		const auto start = std::chrono::steady_clock::now();
+		for( int i = 0; i < iterations; ++i ) {
+			kernel( a.data(), b.data(), out.data(), n );
+		}
+		const auto duration = std::chrono::steady_clock::now() - start;
+		std::cout << to_string( isa ) << ": "
+				  << std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count() / iterations
+				  << " ns per call (" << n << " floats)" << std::endl;
+	}
+	// keeps the compiler from dropping the calls
+	return out[1] == a[1] + b[1] ? 0 : 1;
+}
@@ -0,0 +1,52 @@
+${$SNIPP_$INCLUDE_KERNELS.cpp$$}$
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+using namespace ${$NAMESPACE$}$::kernels;
+
+namespace {
+
+const Isa all_isas[] = {Isa::scalar, Isa::sse42, Isa::avx2, Isa::avx512};
+
+std::vector<float> make_input( std::size_t n, float offset )
+{
+	std::vector<float> v( n );
+	for( std::size_t i = 0; i < n; ++i ) {
+		v[i] = static_cast<float>( i ) * 0.5f + offset;
+	}
+	return v;
+}
+
+} // namespace
+
+TEST_CASE( "kernels_add_every_isa", "[${$TARGET_NAME$}$_tests][kernels]" )
+{
+	for( Isa isa : all_isas ) {
+		const add_fn kernel = get_add_kernel( isa );
+		if( kernel == nullptr ) {
+			WARN( "Kernel not available on this machine: " << to_string( isa ) );
+			continue;
+		}
+		// sizes around the vector widths exercise the remainder loops
+		for( std::size_t n : {0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 33, 1000} ) {
+			const auto         a = make_input( n, 1.0f );
+			const auto         b = make_input( n, -3.0f );
+			std::vector<float> out( n, -1.0f );
+
+			kernel( a.data(), b.data(), out.data(), n );
+			for( std::size_t i = 0; i < n; ++i ) {
+				CHECK( out[i] == a[i] + b[i] );
+			}
+		}
+	}
+}
+
+TEST_CASE( "kernels_dispatch_selects_available_isa", "[${$TARGET_NAME$}$_tests][kernels]" )
+{
+	CHECK( get_add_kernel( Isa::scalar ) != nullptr );
+	CHECK( get_add_kernel( selected_isa() ) != nullptr );
+	std::cout << "Selected kernel: " << to_string( selected_isa() ) << std::endl;
+}
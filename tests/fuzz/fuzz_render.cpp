@@ -0,0 +1,77 @@
+// libFuzzer target: renders random templates with random names through every rendering path
+// and aborts if one of them differs from the regex based reference implementation.
+//
+// Input layout: <project type byte> <project> \0 <target> \0 <namespace> \0 <cmake namespace> \0 <link name> \0 <template>
+// Bytes 0x01 - 0x07 in the template are expanded to the placeholders, so the fuzzer doesn't have to guess them.
+
+#include <cpp_project_lib/render.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace mba;
+
+namespace {
+
+std::string_view next_field( std::string_view& data )
+{
+	const std::size_t end   = data.find( '\0' );
+	const auto        field = data.substr( 0, end );
+	data.remove_prefix( end == std::string_view::npos ? data.size() : end + 1 );
+	return field;
+}
+
+std::string expand_placeholders( std::string_view data )
+{
+	static const char* const placeholders[] = {"${$PROJECT_NAME$}$",
+											   "${$TARGET_NAME$}$",
+											   "${$NAMESPACE$}$",
+											   "${$CMAKE_NAMESPACE$}$",
+											   "${$CMAKE_TARGET_LINK_NAME$}$",
+											   "${$CMAKE_PUBLIC_VISIBILITY$}$",
+											   "${$SNIPP_$file.cmake$$}$"};
+	std::string text;
+	for( char c : data ) {
+		if( c >= 1 && c <= 7 ) {
+			text += placeholders[c - 1];
+		} else {
+			text.push_back( c );
+		}
+	}
+	return text;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput( const std::uint8_t* bytes, std::size_t size )
+{
+	if( size == 0 ) {
+		return 0;
+	}
+	std::string_view data( reinterpret_cast<const char*>( bytes ) + 1, size - 1 );
+
+	Config cfg{};
+	cfg.prj_type                = bytes[0] % 2 == 0 ? ProjectType::lib : ProjectType::lib_header_only;
+	cfg.names.project           = next_field( data );
+	cfg.names.target            = next_field( data );
+	cfg.names.ns                = next_field( data );
+	cfg.names.cmake_ns          = next_field( data );
+	cfg.names.cmake_link_target = next_field( data );
+	const std::string text      = expand_placeholders( data );
+
+	const std::string reference = render_regex( text, cfg );
+
+	std::istringstream in( text );
+	std::ostringstream out;
+	render_streaming( in, out, cfg );
+
+	if( render_single_pass( text, cfg ) != reference || out.str() != reference
+		|| render_parallel( text, cfg, 1 + bytes[0] % 4 ) != reference ) {
+		std::abort();
+	}
+	return 0;
+}
@@ -0,0 +1,11 @@
+#include <cpp_project_lib/Durability.h>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE( "durability_round_trips", "[gen_cpp_prj_tests]" )
+{
+	CHECK( mba::Durability::none == mba::parse_Durability( to_string( mba::Durability::none ) ) );
+	CHECK( mba::Durability::batch == mba::parse_Durability( to_string( mba::Durability::batch ) ) );
+	CHECK( mba::Durability::strict == mba::parse_Durability( to_string( mba::Durability::strict ) ) );
+	CHECK( !mba::parse_Durability( "sometimes" ) );
+}
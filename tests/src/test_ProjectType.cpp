@@ -8,4 +8,27 @@ TEST_CASE( "project_type_round_trips", "[gen_cpp_prj_tests]" )
 	CHECK( mba::ProjectType::lib == mba::parse_ProjectType( to_string( mba::ProjectType::lib) ) );
 	CHECK( mba::ProjectType::lib_header_only
 		   == mba::parse_ProjectType( to_string( mba::ProjectType::lib_header_only ) ) );
+	CHECK( mba::ProjectType::lib_module == mba::parse_ProjectType( to_string( mba::ProjectType::lib_module ) ) );
+	CHECK( mba::ProjectType::lib_module == mba::parse_ProjectType( "module" ) );
+}
+
+TEST_CASE( "project_type_registry", "[gen_cpp_prj_tests]" )
+{
+	for( const auto& t : mba::project_types ) {
+		CHECK( &mba::info( t.type ) == &t );
+		CHECK( t.type == mba::parse_ProjectType( t.short_name ) );
+		CHECK( !t.template_groups[0].empty() );
+	}
+	CHECK( !mba::parse_ProjectType( "" ) );
+	CHECK( !mba::parse_ProjectType( "libraryx" ) );
+
+	static_assert( mba::project_types[(int)mba::ProjectType::lib_header_only].cmake_visibility == "INTERFACE" );
+	static_assert( mba::project_types[(int)mba::ProjectType::lib].cmake_visibility == "PUBLIC" );
+	CHECK( mba::info( mba::ProjectType::exec ).extra_dirs[1] == "libs" );
+
+	for( const auto& t : mba::project_types ) {
+		CHECK( t.has_compiled_sources == !t.source_dir.empty() );
+		CHECK( !t.header_dir.empty() );
+		CHECK( !t.feature_group_suffix.empty() );
+	}
 }
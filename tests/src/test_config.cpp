@@ -30,3 +30,21 @@ TEST_CASE( "detect_name_as_positional_2", "[gen_cpp_prj_tests]" )
 	CHECK( cfg.names.target == "target_name" );
 }
 
+
+TEST_CASE( "simd_dispatch_requires_compiled_sources", "[gen_cpp_prj_tests]" )
+{
+	char  arg0[]   = "";
+	char  arg1[]   = "--simd-dispatch";
+	char  arg2[]   = "-t";
+	char  arg3[]   = "header";
+	char  arg4[]   = "my_name3";
+	char* argv[5] = {arg0, arg1, arg2, arg3, arg4};
+
+	CHECK_THROWS( parse_config( 5, argv ) );
+
+	char  arg5[]    = "lib";
+	char* argv2[5] = {arg0, arg1, arg2, arg5, arg4};
+
+	Config cfg = parse_config( 5, argv2 );
+	CHECK( cfg.simd_dispatch );
+}
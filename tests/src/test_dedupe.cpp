@@ -0,0 +1,107 @@
+#include <cpp_project_lib/dedupe.h>
+
+#include <cpp_project_lib/helpers.h>
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+
+using namespace mba;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const std::string gitignore = "__*__\n";
+const std::string cmake     = "project( x )\n";
+
+// two projects that share .gitignore (never edited) and CMakeLists.txt (editable) and differ in name.txt
+fs::path make_projects( const std::string& name )
+{
+	const fs::path root = fs::temp_directory_path() / name;
+	fs::remove_all( root );
+	for( const char* prj : {"a", "b"} ) {
+		fs::create_directories( root / prj );
+		set_file_content( root / prj / ".gitignore", gitignore );
+		set_file_content( root / prj / "CMakeLists.txt", cmake );
+		set_file_content( root / prj / "name.txt", prj );
+	}
+	return root;
+}
+
+bool is_writable( const fs::path& file )
+{
+	return ( fs::status( file ).permissions() & fs::perms::owner_write ) != fs::perms::none;
+}
+
+} // namespace
+
+TEST_CASE( "dedupe_mode_round_trips", "[gen_cpp_prj_tests]" )
+{
+	CHECK( DedupeMode::none == parse_DedupeMode( to_string( DedupeMode::none ) ) );
+	CHECK( DedupeMode::hardlink == parse_DedupeMode( to_string( DedupeMode::hardlink ) ) );
+	CHECK( DedupeMode::reflink == parse_DedupeMode( to_string( DedupeMode::reflink ) ) );
+	CHECK( !parse_DedupeMode( "symlink" ) );
+}
+
+TEST_CASE( "dedupe_hardlinks_only_never_edited_files", "[gen_cpp_prj_tests][dedupe]" )
+{
+	const fs::path root  = make_projects( "cpp_project_test_dedupe_hardlink" );
+	const fs::path store = root / ".store";
+
+	const DedupeStats first  = dedupe_tree( root / "a", store, DedupeMode::hardlink );
+	const DedupeStats second = dedupe_tree( root / "b", store, DedupeMode::hardlink );
+
+	CHECK( first.files == 3 );
+	CHECK( first.linked_files == 1 );
+	CHECK( first.bytes_saved == 0 );
+	CHECK( second.files == 3 );
+	CHECK( second.linked_files == 1 );
+	CHECK( second.bytes_saved == gitignore.size() );
+
+	// both projects and the store object
+	CHECK( fs::hard_link_count( root / "a" / ".gitignore" ) == 3 );
+	CHECK( fs::hard_link_count( root / "b" / ".gitignore" ) == 3 );
+	CHECK( !is_writable( root / "b" / ".gitignore" ) );
+
+	for( const char* prj : {"a", "b"} ) {
+		for( const char* file : {"CMakeLists.txt", "name.txt"} ) {
+			CHECK( fs::hard_link_count( root / prj / file ) == 1 );
+			CHECK( is_writable( root / prj / file ) );
+		}
+		CHECK( get_file_content( root / prj / ".gitignore" ) == gitignore );
+		CHECK( get_file_content( root / prj / "CMakeLists.txt" ) == cmake );
+		CHECK( get_file_content( root / prj / "name.txt" ) == prj );
+	}
+
+	fs::remove_all( root );
+}
+
+TEST_CASE( "dedupe_reflinks_files_shared_by_projects", "[gen_cpp_prj_tests][dedupe]" )
+{
+	const fs::path root  = make_projects( "cpp_project_test_dedupe_reflink" );
+	const fs::path store = root / ".store";
+
+	const DedupeStats first  = dedupe_tree( root / "a", store, DedupeMode::reflink );
+	const DedupeStats second = dedupe_tree( root / "b", store, DedupeMode::reflink );
+
+	CHECK( first.files == 3 );
+	CHECK( first.bytes_saved == 0 );
+	CHECK( second.files == 3 );
+	if( second.linked_files > 0 ) { // reflinks are not supported by every file system
+		CHECK( second.linked_files == 2 );
+		CHECK( second.bytes_saved == gitignore.size() + cmake.size() );
+	}
+
+	for( const char* prj : {"a", "b"} ) {
+		for( const char* file : {".gitignore", "CMakeLists.txt", "name.txt"} ) {
+			CHECK( fs::hard_link_count( root / prj / file ) == 1 );
+			CHECK( is_writable( root / prj / file ) );
+		}
+		CHECK( get_file_content( root / prj / ".gitignore" ) == gitignore );
+		CHECK( get_file_content( root / prj / "CMakeLists.txt" ) == cmake );
+		CHECK( get_file_content( root / prj / "name.txt" ) == prj );
+	}
+
+	fs::remove_all( root );
+}
@@ -20,3 +20,14 @@ TEST_CASE( "capitalize_first", "[gen_cpp_prj_tests]" )
 	CHECK( capitalize_first( "hello world" ) == "Hello world" );
 	CHECK( capitalize_first( "Hello World" ) == "Hello World" );
 }
+
+TEST_CASE( "project_subdir", "[gen_cpp_prj_tests]" )
+{
+	Config cfg{};
+	cfg.project_dir  = "prj";
+	cfg.names.target = "my_target";
+
+	CHECK( project_subdir( "src/TARGET_NAME_lib", cfg ) == std::filesystem::path( "prj/src/my_target_lib" ) );
+	CHECK( project_subdir( "include/TARGET_NAME", cfg ) == std::filesystem::path( "prj/include/my_target" ) );
+	CHECK( project_subdir( "", cfg ) == std::filesystem::path( "prj" ) );
+}
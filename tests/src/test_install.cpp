@@ -0,0 +1,130 @@
+#include <cpp_project_lib/install.h>
+
+#include <cpp_project_lib/helpers.h>
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace mba;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// only contains the "common" group, so installing fails after the first files have been generated
+Config make_broken_config( const fs::path& root )
+{
+	fs::remove_all( root );
+	fs::create_directories( root / "templates" / "common" );
+	set_file_content( root / "templates" / "common" / "README.md", "# ${$PROJECT_NAME$}$\n" );
+
+	Config cfg{};
+	cfg.prj_type     = ProjectType::exec;
+	cfg.names        = create_default_names( "my_project" );
+	cfg.project_dir  = root / "my_project";
+	cfg.template_dir = root / "templates";
+	return cfg;
+}
+
+} // namespace
+
+TEST_CASE( "failed_install_leaves_nothing_behind", "[gen_cpp_prj_tests][staging]" )
+{
+	const fs::path root = fs::temp_directory_path() / "cpp_project_test_install";
+
+	for( Durability durability : {Durability::batch, Durability::strict} ) {
+		Config cfg     = make_broken_config( root );
+		cfg.durability = durability;
+
+		CHECK_THROWS( install_project( cfg ) );
+
+		// neither the project nor a .my_project.staging-* directory
+		for( const auto& entry : fs::directory_iterator( root ) ) {
+			CHECK( entry.path().filename() == "templates" );
+		}
+	}
+
+	fs::remove_all( root );
+}
+
+TEST_CASE( "staged_install_publishes_project", "[gen_cpp_prj_tests][staging]" )
+{
+	const fs::path root = fs::temp_directory_path() / "cpp_project_test_install_ok";
+
+	Config cfg     = make_broken_config( root );
+	cfg.durability = Durability::batch;
+	fs::create_directories( cfg.template_dir / "exec" );
+	set_file_content( cfg.template_dir / "exec" / "main.cpp", "int main() {}\n" );
+
+	install_project( cfg );
+
+	CHECK( get_file_content( cfg.project_dir / "README.md" ) == "# my_project\n" );
+	CHECK( fs::exists( cfg.project_dir / "main.cpp" ) );
+	int entries = 0;
+	for( const auto& entry : fs::directory_iterator( root ) ) {
+		CHECK( ( entry.path() == cfg.project_dir || entry.path().filename() == "templates" ) );
+		++entries;
+	}
+	CHECK( entries == 2 );
+
+	fs::remove_all( root );
+}
+
+TEST_CASE( "staged_install_records_published_paths_for_dedupe", "[gen_cpp_prj_tests][staging][dedupe]" )
+{
+	const fs::path root = fs::temp_directory_path() / "cpp_project_test_install_dedupe";
+
+	Config cfg       = make_broken_config( root );
+	cfg.durability   = Durability::batch;
+	cfg.dedupe       = DedupeMode::reflink;
+	cfg.dedupe_store = root / "store";
+	fs::create_directories( cfg.template_dir / "exec" );
+	set_file_content( cfg.template_dir / "exec" / "shared.txt", "same in every project\n" );
+
+	// locations of the files in the pending index of the store
+	const auto pending_records = [&] {
+		std::vector<std::string> records;
+		if( fs::exists( cfg.dedupe_store / "pending" ) ) {
+			for( const auto& shard : fs::directory_iterator( cfg.dedupe_store / "pending" ) ) {
+				std::ifstream in( shard.path() );
+				std::string   line;
+				while( std::getline( in, line ) ) {
+					records.push_back( line.substr( line.find( ' ' ) + 1 ) );
+				}
+			}
+		}
+		return records;
+	};
+
+	cfg.names       = create_default_names( "a" );
+	cfg.project_dir = root / "a";
+	install_project( cfg );
+
+	// README.md and shared.txt, both have to point into the published project, not into the staging directory
+	auto records = pending_records();
+	CHECK( records.size() == 2 );
+	for( const auto& record : records ) {
+		CHECK( fs::path( record ).parent_path() == fs::absolute( root / "a" ) );
+		CHECK( fs::exists( record ) );
+	}
+
+	cfg.names       = create_default_names( "b" );
+	cfg.project_dir = root / "b";
+	install_project( cfg );
+
+	// shared.txt of project a was found, so its record was replaced by an object (the READMEs differ)
+	records = pending_records();
+	CHECK( records.size() == 2 );
+	for( const auto& record : records ) {
+		CHECK( fs::path( record ).filename() == "README.md" );
+	}
+	for( const char* prj : {"a", "b"} ) {
+		CHECK( get_file_content( root / prj / "shared.txt" ) == "same in every project\n" );
+	}
+
+	fs::remove_all( root );
+}
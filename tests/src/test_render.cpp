@@ -0,0 +1,134 @@
+#include <cpp_project_lib/render.h>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mba;
+
+namespace {
+
+Config make_config( ProjectType type, std::string project )
+{
+	Config cfg{};
+	cfg.prj_type = type;
+	cfg.names    = create_default_names( project );
+	return cfg;
+}
+
+std::string render_streaming( const std::string& text, const Config& cfg )
+{
+	std::istringstream in( text );
+	std::ostringstream out;
+	render_streaming( in, out, cfg );
+	return out.str();
+}
+
+void check_all_paths_match( const std::string& text, const Config& cfg )
+{
+	const std::string reference = render_regex( text, cfg );
+	CHECK( render_single_pass( text, cfg ) == reference );
+	CHECK( render_streaming( text, cfg ) == reference );
+	CHECK( render_parallel( text, cfg, 3 ) == reference );
+}
+
+class Generator {
+public:
+	explicit Generator( unsigned seed )
+		: _rng( seed )
+	{
+	}
+
+	// mostly plain names (so the fast paths don't fall back to the reference), but also nasty ones
+	std::string name()
+	{
+		static const std::string plain = "abcxyz_019";
+		static const std::string nasty = "ab$${}{}\\\r\n.*+?()[]^|&'`NAMESPACE_";
+		const bool               bad   = pick( 10 ) == 0;
+		const std::string&       chars = bad ? nasty : plain;
+		std::string              s;
+		for( std::size_t i = 0, n = bad ? pick( 6 ) : 1 + pick( 6 ); i < n; ++i ) {
+			s.push_back( chars[pick( chars.size() )] );
+		}
+		return s;
+	}
+
+	// random mix of placeholders, fragments of placeholders and special characters
+	std::string text()
+	{
+		static const std::vector<std::string> tokens = {
+			"${$PROJECT_NAME$}$", "${$TARGET_NAME$}$", "${$NAMESPACE$}$", "${$CMAKE_NAMESPACE$}$",
+			"${$CMAKE_TARGET_LINK_NAME$}$", "${$CMAKE_PUBLIC_VISIBILITY$}$", "${$SNIPP_$file.cmake$$}$",
+			"${$", "$}$", "$", "{", "}", "NAME", "NAMESPACE", "PROJECT_", "CMAKE_", "_", "\\", "\r\n", "\n",
+			"a", " ", ".*", "(", ")", "[", "]", "^", "|", "&", "$&", "$1", "$$", "$`", "$'"};
+		std::string s;
+		for( std::size_t i = 0, n = pick( 40 ); i < n; ++i ) {
+			s += tokens[pick( tokens.size() )];
+		}
+		return s;
+	}
+
+	ProjectType type() { return pick( 2 ) == 0 ? ProjectType::lib_header_only : ProjectType::lib; }
+
+private:
+	std::size_t pick( std::size_t n ) { return std::uniform_int_distribution<std::size_t>( 0, n - 1 )( _rng ); }
+
+	std::mt19937 _rng;
+};
+
+} // namespace
+
+TEST_CASE( "render_examples", "[gen_cpp_prj_tests][render]" )
+{
+	const Config cfg = make_config( ProjectType::lib, "Hello" );
+
+	CHECK( render_regex( "", cfg ) == "" );
+	CHECK( render_regex( "${$PROJECT_NAME$}$", cfg ) == "Hello\n" );
+	CHECK( render_regex( "a ${$TARGET_NAME$}$\r\nb ${$CMAKE_PUBLIC_VISIBILITY$}$\n", cfg ) == "a hello\r\nb PUBLIC\n" );
+	CHECK( render_regex( "${$CMAKE_TARGET_LINK_NAME$}$", cfg ) == "Hello::hello\n" );
+	CHECK( render_regex( "${$CMAKE_PUBLIC_VISIBILITY$}$", make_config( ProjectType::lib_header_only, "x" ) )
+		   == "INTERFACE\n" );
+
+	// the reference keeps the std::regex_replace format semantics of replace_inplace: '$' in a value is a
+	// back reference ($& is the placeholder itself, $1 is empty and $$ is a single '$')
+	Config dollar        = cfg;
+	dollar.names.project = "a$&b$1$$";
+	CHECK( render_regex( "${$PROJECT_NAME$}$", dollar ) == "a${$PROJECT_NAME$}$b$\n" );
+
+	check_all_paths_match( "${$PROJECT_NAME$}$ ${$SNIPP_$file.cmake$$}$\nlast line", cfg );
+	check_all_paths_match( "${$${$PROJECT_NAME$}$$}$", dollar );
+	check_all_paths_match( "${$TARGET_NAME$}${$PROJECT_NAME$}$", cfg );
+}
+
+TEST_CASE( "render_paths_match_reference", "[gen_cpp_prj_tests][render]" )
+{
+	// time boxed, so it can run as part of every test run
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 2 );
+
+	// reproduce a failure with: <test executable> render_paths_match_reference --rng-seed <seed>
+	// (--rng-seed time explores new inputs)
+	const unsigned seed = Catch::rngSeed();
+	INFO( "seed: " << seed );
+	Generator gen( seed );
+
+	for( int i = 0; i < 100000 && std::chrono::steady_clock::now() < deadline; ++i ) {
+		Config cfg                  = make_config( gen.type(), gen.name() );
+		cfg.names.target            = gen.name();
+		cfg.names.ns                = gen.name();
+		cfg.names.cmake_ns          = gen.name();
+		cfg.names.cmake_link_target = gen.name();
+
+		const std::string text = gen.text();
+		INFO( "template: " << text );
+		INFO( "project: " << cfg.names.project << " target: " << cfg.names.target << " ns: " << cfg.names.ns
+						  << " cmake ns: " << cfg.names.cmake_ns << " link: " << cfg.names.cmake_link_target );
+		const std::string reference = render_regex( text, cfg );
+		REQUIRE( render_single_pass( text, cfg ) == reference );
+		REQUIRE( render_streaming( text, cfg ) == reference );
+		REQUIRE( render_parallel( text, cfg, 1 + i % 4 ) == reference );
+	}
+}
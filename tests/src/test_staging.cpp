@@ -0,0 +1,66 @@
+#include <cpp_project_lib/staging.h>
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace mba;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+fs::path make_staged_project( const fs::path& project_dir )
+{
+	const fs::path staging = create_staging_directory( project_dir );
+	fs::create_directories( staging / "src" );
+	std::ofstream( staging / "src" / "main.cpp" ) << "int main() {}\n";
+	return staging;
+}
+
+} // namespace
+
+TEST_CASE( "staging_directories_are_unique_siblings", "[gen_cpp_prj_tests][staging]" )
+{
+	const fs::path project_dir = fs::temp_directory_path() / "my_project";
+	const fs::path first       = create_staging_directory( project_dir );
+	const fs::path second      = create_staging_directory( project_dir );
+	CHECK( first.parent_path() == project_dir.parent_path() );
+	CHECK( fs::is_directory( first ) );
+	CHECK( first != project_dir );
+	CHECK( first != second );
+	fs::remove( first );
+	fs::remove( second );
+}
+
+TEST_CASE( "publish_staged_project", "[gen_cpp_prj_tests][staging]" )
+{
+	for( Durability durability : {Durability::none, Durability::batch, Durability::strict} ) {
+		const fs::path project_dir = fs::temp_directory_path() / "cpp_project_test_publish";
+		fs::remove_all( project_dir );
+
+		const fs::path staging = make_staged_project( project_dir );
+		make_durable( staging, durability );
+		publish_directory( staging, project_dir );
+
+		CHECK( !fs::exists( staging ) );
+		CHECK( fs::exists( project_dir / "src" / "main.cpp" ) );
+		fs::remove_all( project_dir );
+	}
+}
+
+TEST_CASE( "publish_does_not_replace_existing_project", "[gen_cpp_prj_tests][staging]" )
+{
+	const fs::path project_dir = fs::temp_directory_path() / "cpp_project_test_existing";
+	fs::remove_all( project_dir );
+	fs::create_directories( project_dir );
+	std::ofstream( project_dir / "keep.txt" ) << "user data\n";
+
+	const fs::path staging = make_staged_project( project_dir );
+	CHECK_THROWS( publish_directory( staging, project_dir ) );
+	CHECK( fs::exists( project_dir / "keep.txt" ) );
+
+	fs::remove_all( staging );
+	fs::remove_all( project_dir );
+}